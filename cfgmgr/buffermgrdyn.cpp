@@ -51,7 +51,12 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         m_bufferPoolReady(false),
         m_bufferObjectsPending(true),
         m_bufferCompletelyInitialized(false),
-        m_mmuSizeNumber(0)
+        m_mmuSizeNumber(0),
+        m_headroomCacheHits(0),
+        m_headroomCacheMisses(0),
+        m_headroomCacheInvalidations(0),
+        m_headroomCacheStatsDirty(true),
+        m_stateHeadroomCacheTable(stateDb, STATE_BUFFER_HEADROOM_CACHE_TABLE)
 {
     SWSS_LOG_ENTER();
 
@@ -436,6 +441,8 @@ void BufferMgrDynamic::initTableHandlerMap()
 {
     m_bufferTableHandlerMap.insert(buffer_handler_pair(STATE_BUFFER_MAXIMUM_VALUE_TABLE, &BufferMgrDynamic::handleBufferMaxParam));
     m_bufferTableHandlerMap.insert(buffer_handler_pair(CFG_DEFAULT_LOSSLESS_BUFFER_PARAMETER, &BufferMgrDynamic::handleDefaultLossLessBufferParam));
+    m_bufferTableHandlerMap.insert(buffer_handler_pair(CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE_NAME, &BufferMgrDynamic::handleLosslessTrafficPatternTable));
+    m_bufferTableHandlerMap.insert(buffer_handler_pair(STATE_ASIC_TABLE_NAME, &BufferMgrDynamic::handleAsicTable));
     m_bufferTableHandlerMap.insert(buffer_handler_pair(CFG_BUFFER_POOL_TABLE_NAME, &BufferMgrDynamic::handleBufferPoolTable));
     m_bufferTableHandlerMap.insert(buffer_handler_pair(CFG_BUFFER_PROFILE_TABLE_NAME, &BufferMgrDynamic::handleBufferProfileTable));
     m_bufferTableHandlerMap.insert(buffer_handler_pair(CFG_BUFFER_QUEUE_TABLE_NAME, &BufferMgrDynamic::handleBufferQueueTable));
@@ -595,9 +602,66 @@ bool BufferMgrDynamic::needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo,
     return effectiveSpeedChanged;
 }
 
+// The headroom is determined by the parameters passed to the lua plugin only,
+// as long as the global parameters it reads from the database remain unchanged.
+// The threshold is not passed to the plugin, so profiles differing only in threshold share an entry.
+string BufferMgrDynamic::getHeadroomCacheKey(const buffer_profile_t &headroom)
+{
+    return headroom.speed + "|" + headroom.cable_length + "|" + headroom.port_mtu + "|"
+        + headroom.gearbox_model + "|" + to_string(headroom.lane_count);
+}
+
+void BufferMgrDynamic::invalidateHeadroomCache(const string &reason)
+{
+    if (m_headroomCache.empty())
+    {
+        return;
+    }
+
+    SWSS_LOG_INFO("Flushing %zu cached headroom entries due to %s updated", m_headroomCache.size(), reason.c_str());
+    m_headroomCache.clear();
+    m_headroomCacheInvalidations++;
+    m_headroomCacheStatsDirty = true;
+}
+
+void BufferMgrDynamic::updateHeadroomCacheStatsToDb()
+{
+    if (!m_headroomCacheStatsDirty)
+    {
+        return;
+    }
+
+    vector<FieldValueTuple> fvVector;
+
+    fvVector.emplace_back("hits", to_string(m_headroomCacheHits));
+    fvVector.emplace_back("misses", to_string(m_headroomCacheMisses));
+    fvVector.emplace_back("invalidations", to_string(m_headroomCacheInvalidations));
+    fvVector.emplace_back("entries", to_string(m_headroomCache.size()));
+
+    m_stateHeadroomCacheTable.set("global", fvVector);
+    m_headroomCacheStatsDirty = false;
+}
+
 // Meta flows which are called by main flows
 void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
 {
+    auto cacheKey = getHeadroomCacheKey(headroom);
+    auto cacheRef = m_headroomCache.find(cacheKey);
+
+    m_headroomCacheStatsDirty = true;
+    if (cacheRef != m_headroomCache.end())
+    {
+        auto &cached = cacheRef->second;
+        headroom.xon = cached.xon;
+        headroom.xoff = cached.xoff;
+        headroom.size = cached.size;
+        headroom.xon_offset = cached.xon_offset;
+        m_headroomCacheHits++;
+        SWSS_LOG_INFO("Headroom for %s fetched from cache (%s)", headroom.name.c_str(), cacheKey.c_str());
+        return;
+    }
+    m_headroomCacheMisses++;
+
     // Call vendor-specific lua plugin to calculate the xon, xoff, xon_offset, size and threshold
     vector<string> keys = {};
     vector<string> argv = {};
@@ -638,6 +702,12 @@ void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
             if (pairs[0] == "xon_offset")
                 headroom.xon_offset = pairs[1];
         }
+
+        auto &cached = m_headroomCache[cacheKey];
+        cached.xon = headroom.xon;
+        cached.xoff = headroom.xoff;
+        cached.size = headroom.size;
+        cached.xon_offset = headroom.xon_offset;
     }
     catch (...)
     {
@@ -1602,6 +1672,8 @@ void BufferMgrDynamic::refreshSharedHeadroomPool(bool enable_state_updated_by_ra
     {
         SWSS_LOG_NOTICE("Updating dynamic buffer profiles due to shared headroom pool state updated");
 
+        invalidateHeadroomCache("shared headroom pool state");
+
         for (auto it = m_bufferProfileLookup.begin(); it != m_bufferProfileLookup.end(); ++it)
         {
             auto &name = it->first;
@@ -1805,6 +1877,34 @@ task_process_status BufferMgrDynamic::doUpdateBufferProfileForSize(buffer_profil
     return task_process_status::task_success;
 }
 
+/*
+ * handleLosslessTrafficPatternTable, handles the LOSSLESS_TRAFFIC_PATTERN table.
+ * The traffic pattern (mtu, small packet percentage) is read by the headroom plugin from CONFIG_DB,
+ * so the headrooms calculated with the previous pattern are flushed from the cache.
+ */
+task_process_status BufferMgrDynamic::handleLosslessTrafficPatternTable(KeyOpFieldsValuesTuple &tuple)
+{
+    SWSS_LOG_ENTER();
+
+    invalidateHeadroomCache("lossless traffic pattern " + kfvKey(tuple));
+
+    return task_process_status::task_success;
+}
+
+/*
+ * handleAsicTable, handles the ASIC_TABLE table in STATE_DB.
+ * The ASIC parameters (cell size, pipeline latency, mac phy delay...) are read by the headroom plugin,
+ * so the headrooms calculated with the previous parameters are flushed from the cache.
+ */
+task_process_status BufferMgrDynamic::handleAsicTable(KeyOpFieldsValuesTuple &tuple)
+{
+    SWSS_LOG_ENTER();
+
+    invalidateHeadroomCache("ASIC table " + kfvKey(tuple));
+
+    return task_process_status::task_success;
+}
+
 /*
  * handleBufferMaxParam, handles the BUFFER_MAX_PARAMETER table which contains some thresholds related to buffer.
  * The available fields depend on the key of the item:
@@ -1902,6 +2002,7 @@ task_process_status BufferMgrDynamic::handleBufferMaxParam(KeyOpFieldsValuesTupl
                         SWSS_LOG_ERROR("BUFFER_MAX_PARAM: Got invalid mmu size %s", m_mmuSize.c_str());
                         return task_process_status::task_failed;
                     }
+                    invalidateHeadroomCache("mmu size");
                     SWSS_LOG_DEBUG("Handling Default Lossless Buffer Param table field mmu_size %s", m_mmuSize.c_str());
                 }
             }
@@ -1948,6 +2049,8 @@ task_process_status BufferMgrDynamic::handleDefaultLossLessBufferParam(KeyOpFiel
         return task_process_status::task_failed;
     }
 
+    invalidateHeadroomCache("default lossless buffer parameter");
+
     if (newRatio != m_overSubscribeRatio)
     {
         bool isSHPEnabled = isNonZero(m_overSubscribeRatio);
@@ -2379,6 +2482,10 @@ task_process_status BufferMgrDynamic::handleBufferPoolTable(KeyOpFieldsValuesTup
     vector<FieldValueTuple> fvVector;
 
     SWSS_LOG_DEBUG("Processing command:%s table BUFFER_POOL key %s", op.c_str(), pool.c_str());
+
+    // The headroom plugin can read the pools, eg. to check whether shared headroom pool is enabled
+    invalidateHeadroomCache("buffer pool " + pool);
+
     if (op == SET_COMMAND)
     {
         // For set command:
@@ -3626,4 +3733,5 @@ void BufferMgrDynamic::doTask(SelectableTimer &timer)
     {
         handlePendingBufferObjects();
     }
+    updateHeadroomCacheStatsToDb();
 }
@@ -16,6 +16,12 @@ namespace swss {
 
 #define BUFFERMGR_TIMER_PERIOD 10
 
+#define STATE_BUFFER_HEADROOM_CACHE_TABLE "BUFFER_HEADROOM_CACHE_TABLE"
+
+// Tables read by the headroom plugin, only watched to flush the headroom cache
+#define CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE_NAME "LOSSLESS_TRAFFIC_PATTERN"
+#define STATE_ASIC_TABLE_NAME "ASIC_TABLE"
+
 typedef enum {
     BUFFER_INGRESS = 0,
     BUFFER_PG = BUFFER_INGRESS,
@@ -144,6 +150,16 @@ typedef std::map<std::string, std::string> port_profile_list_lookup_t;
 //map from gearbox model to gearbox delay
 typedef std::map<std::string, std::string> gearbox_delay_t;
 
+// Headroom calculated by the vendor-specific lua plugin
+typedef struct {
+    std::string xon;
+    std::string xoff;
+    std::string xon_offset;
+    std::string size;
+} headroom_result_t;
+//map from headroom parameters to the calculated headroom
+typedef std::map<std::string, headroom_result_t> headroom_cache_t;
+
 class BufferMgrDynamic : public Orch
 {
 public:
@@ -263,6 +279,18 @@ private:
 
     std::string m_overSubscribeRatio;
 
+    // Cache of headroom calculated by the lua plugin
+    // key: speed, cable length, mtu, gearbox model and lane count of the profile
+    // It is flushed whenever any input of the lua plugin other than the key changes,
+    // like DEFAULT_LOSSLESS_BUFFER_PARAMETER, BUFFER_MAX_PARAM and BUFFER_POOL.
+    // The statistics are exposed in STATE_DB.BUFFER_HEADROOM_CACHE_TABLE
+    headroom_cache_t m_headroomCache;
+    uint64_t m_headroomCacheHits;
+    uint64_t m_headroomCacheMisses;
+    uint64_t m_headroomCacheInvalidations;
+    bool m_headroomCacheStatsDirty;
+    Table m_stateHeadroomCacheTable;
+
     // Initializers
     void initTableHandlerMap();
     void parseGearboxInfo(std::shared_ptr<std::vector<KeyOpFieldsValuesTuple>> gearboxInfo);
@@ -290,6 +318,9 @@ private:
     // Meta flows
     bool needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo, std::string &portName);
     void calculateHeadroomSize(buffer_profile_t &headroom);
+    std::string getHeadroomCacheKey(const buffer_profile_t &headroom);
+    void invalidateHeadroomCache(const std::string &reason);
+    void updateHeadroomCacheStatsToDb();
     void checkSharedBufferPoolSize(bool force_update_during_initialization);
     void recalculateSharedBufferPool();
     task_process_status allocateProfile(const std::string &speed, const std::string &cable, const std::string &mtu, const std::string &threshold, const std::string &gearbox_model, long lane_count, std::string &profile_name);
@@ -318,6 +349,8 @@ private:
     // Table update handlers
     task_process_status handleBufferMaxParam(KeyOpFieldsValuesTuple &tuple);
     task_process_status handleDefaultLossLessBufferParam(KeyOpFieldsValuesTuple &tuple);
+    task_process_status handleLosslessTrafficPatternTable(KeyOpFieldsValuesTuple &tuple);
+    task_process_status handleAsicTable(KeyOpFieldsValuesTuple &tuple);
     task_process_status handleCableLenTable(KeyOpFieldsValuesTuple &tuple);
     task_process_status handlePortStateTable(KeyOpFieldsValuesTuple &tuple);
     task_process_status handlePortTable(KeyOpFieldsValuesTuple &tuple);
@@ -3,6 +3,8 @@
 #include <net/if.h>
 #include <unistd.h>
 #include <netlink/cache.h>
+#include <netlink/msg.h>
+#include <linux/rtnetlink.h>
 
 #include "logger.h"
 #include "tokenize.h"
@@ -15,6 +17,10 @@
 
 using namespace swss;
 
+/* Route requests sent before reading their acks, few enough for the acks to fit in the socket receive buffer */
+#define KERNEL_ROUTE_BATCH_SIZE 64
+#define KERNEL_ROUTE_V6_METRIC  256
+
 static bool send_message(struct nl_sock *sk, struct nl_msg *msg)
 {
     bool rc = false;
@@ -41,6 +47,126 @@ static bool send_message(struct nl_sock *sk, struct nl_msg *msg)
     return rc;
 }
 
+/*
+ * Read the acks of the requests sent on the socket. pending maps the sequence
+ * number of the requests waiting for their ack to their index in errors. The
+ * acks of other requests, e.g. of the neighbor requests which are not waited
+ * for, are skipped.
+ */
+static void recv_acks(struct nl_sock *sk, map<uint32_t, size_t> &pending, vector<int> &errors)
+{
+    while (!pending.empty())
+    {
+        struct sockaddr_nl nla;
+        unsigned char *buf = nullptr;
+
+        int len = nl_recv(sk, &nla, &buf, nullptr);
+        if (len <= 0)
+        {
+            SWSS_LOG_ERROR("Netlink receive acks failed, error '%s', %zu requests not acked",
+                           nl_geterror(len), pending.size());
+            free(buf);
+            return;
+        }
+
+        struct nlmsghdr *hdr = reinterpret_cast<struct nlmsghdr *>(buf);
+        for (; nlmsg_ok(hdr, len); hdr = nlmsg_next(hdr, &len))
+        {
+            if (hdr->nlmsg_type != NLMSG_ERROR)
+            {
+                continue;
+            }
+
+            auto it = pending.find(hdr->nlmsg_seq);
+            if (it == pending.end())
+            {
+                continue;
+            }
+
+            struct nlmsgerr *err = static_cast<struct nlmsgerr *>(nlmsg_data(hdr));
+            errors[it->second] = err->error;
+            pending.erase(it);
+        }
+
+        free(buf);
+    }
+}
+
+static struct nl_msg *build_route_message(uint16_t type, int ifindex, const IpAddress &ip)
+{
+    struct nl_msg *msg = nlmsg_alloc();
+    if (!msg)
+    {
+        return nullptr;
+    }
+
+    auto flags = NLM_F_REQUEST | NLM_F_ACK;
+    if (type == RTM_NEWROUTE)
+    {
+        flags |= NLM_F_CREATE | NLM_F_EXCL;
+    }
+
+    if (!nlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, type, 0, flags))
+    {
+        nlmsg_free(msg);
+        return nullptr;
+    }
+
+    struct rtmsg rt_msg;
+    memset(&rt_msg, 0, sizeof(struct rtmsg));
+
+    rt_msg.rtm_family = ip.isV4() ? AF_INET : AF_INET6;
+    rt_msg.rtm_dst_len = ip.isV4() ? 32 : 128;
+    rt_msg.rtm_table = RT_TABLE_MAIN;
+    if (type == RTM_NEWROUTE)
+    {
+        rt_msg.rtm_protocol = RTPROT_BOOT;
+        rt_msg.rtm_scope = RT_SCOPE_LINK;
+        rt_msg.rtm_type = RTN_UNICAST;
+    }
+    else
+    {
+        rt_msg.rtm_scope = RT_SCOPE_NOWHERE;
+    }
+
+    auto ip_addr = ip.getIp();
+    int err = nlmsg_append(msg, &rt_msg, sizeof(struct rtmsg), NLMSG_ALIGNTO);
+    if (!err)
+    {
+        if (ip.isV4())
+        {
+            err = nla_put(msg, RTA_DST, sizeof(ip_addr.ip_addr.ipv4_addr), &ip_addr.ip_addr.ipv4_addr);
+        }
+        else
+        {
+            err = nla_put(msg, RTA_DST, sizeof(ip_addr.ip_addr.ipv6_addr), &ip_addr.ip_addr.ipv6_addr);
+        }
+    }
+
+    if (!err && type == RTM_NEWROUTE)
+    {
+        err = nla_put_u32(msg, RTA_OIF, ifindex);
+
+        // In voq system, We need the static route to the remote neighbor and connected
+        // route to have the same metric to enable BGP to choose paths from routes learned
+        // via eBGP and iBGP over the internal inband port be part of same ecmp group.
+        // For v4 both the metrics (connected and static) are default 0 so we do not need
+        // to set the metric explicitly.
+        if (!err && !ip.isV4())
+        {
+            err = nla_put_u32(msg, RTA_PRIORITY, KERNEL_ROUTE_V6_METRIC);
+        }
+    }
+
+    if (err < 0)
+    {
+        nlmsg_free(msg);
+        return nullptr;
+    }
+
+    return msg;
+}
+
 NbrMgr::NbrMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<string> &tableNames) :
         Orch(cfgDb, tableNames),
         m_statePortTable(stateDb, STATE_PORT_TABLE_NAME),
@@ -362,12 +488,18 @@ void NbrMgr::doStateSystemNeighTask(Consumer &consumer)
         return;
     }
 
+    //The routes of the neighbors are added and deleted in netlink batches.
+    //Deletions are processed first, since a key deleted and set again has
+    //its DEL before its SET in m_toSync.
+    vector<SyncMap::iterator> entries;
+    vector<IpAddress> ip_addresses;
+    vector<int> errors;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
         KeyOpFieldsValuesTuple t = it->second;
         string key = kfvKey(t);
-        string op = kfvOp(t);
 
         size_t found = key.find_last_of(state_db_key_delimiter);
         if (found == string::npos)
@@ -377,76 +509,119 @@ void NbrMgr::doStateSystemNeighTask(Consumer &consumer)
             continue;
         }
 
-        IpAddress ip_address(key.substr(found+1));
-        if (op == SET_COMMAND)
+        if (kfvOp(t) == DEL_COMMAND)
         {
-            MacAddress mac_address;
-            for (auto i = kfvFieldsValues(t).begin();
-                 i  != kfvFieldsValues(t).end(); i++)
-            {
-                if (fvField(*i) == "neigh")
-                    mac_address = MacAddress(fvValue(*i));
-            }
+            entries.push_back(it);
+            ip_addresses.emplace_back(key.substr(found+1));
+        }
+        else if (kfvOp(t) != SET_COMMAND)
+        {
+            SWSS_LOG_ERROR("Unknown operation: '%s'", kfvOp(t).c_str());
+            it = consumer.m_toSync.erase(it);
+            continue;
+        }
+        it++;
+    }
 
-            if (ibif_type == "port" && !isIntfOperUp(nbr_odev))
-            {
-                SWSS_LOG_DEBUG("Device %s is not oper up, skipping system neigh %s'", nbr_odev.c_str(), kfvKey(t).c_str());
-                it++;
-                continue;
-            }
+    delKernelRoutes(ip_addresses, errors);
 
-            if (!addKernelNeigh(nbr_odev, ip_address, mac_address))
-            {
-                SWSS_LOG_INFO("Neigh entry add on dev %s failed for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
-                // Delete neigh to take care of deletion of exiting nbr for mac change. This makes sure that
-                // re-try will be successful and route addtion (below) will be attempted and be successful
-                delKernelNeigh(nbr_odev, ip_address);
-                it++;
-                continue;
-            }
-            else
-            {
-                SWSS_LOG_NOTICE("Neigh entry added on dev %s for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
-            }
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        const string &key = kfvKey(entries[i]->second);
 
-            if (!addKernelRoute(nbr_odev, ip_address))
-            {
-                SWSS_LOG_INFO("Route entry add on dev %s failed for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
-                delKernelNeigh(nbr_odev, ip_address);
-                // Delete route to take care of deletion of exiting route of nbr for mac change.
-                delKernelRoute(ip_address);
-                it++;
-                continue;
-            }
-            else
-            {
-                SWSS_LOG_NOTICE("Route entry added on dev %s for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
-            }
-            SWSS_LOG_NOTICE("Added voq neighbor %s to kernel", kfvKey(t).c_str());
+        if (errors[i])
+        {
+            SWSS_LOG_ERROR("Route entry on dev %s delete failed for '%s'", nbr_odev.c_str(), key.c_str());
         }
-        else if (op == DEL_COMMAND)
+        else
         {
-            if (!delKernelRoute(ip_address))
-            {
-                SWSS_LOG_ERROR("Route entry on dev %s delete failed for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
-            }
-            else
-            {
-                SWSS_LOG_NOTICE("Route entry on dev %s deleted for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
-            }
+            SWSS_LOG_NOTICE("Route entry on dev %s deleted for '%s'", nbr_odev.c_str(), key.c_str());
+        }
 
-            if (!delKernelNeigh(nbr_odev, ip_address))
-            {
-                SWSS_LOG_ERROR("Neigh entry on dev %s delete failed for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
-            }
-            else
-            {
-                SWSS_LOG_NOTICE("Neigh entry on dev %s deleted for '%s'", nbr_odev.c_str(), kfvKey(t).c_str());
-            }
-            SWSS_LOG_DEBUG("Deleted voq neighbor %s from kernel", kfvKey(t).c_str());
+        if (!delKernelNeigh(nbr_odev, ip_addresses[i]))
+        {
+            SWSS_LOG_ERROR("Neigh entry on dev %s delete failed for '%s'", nbr_odev.c_str(), key.c_str());
+        }
+        else
+        {
+            SWSS_LOG_NOTICE("Neigh entry on dev %s deleted for '%s'", nbr_odev.c_str(), key.c_str());
         }
+        SWSS_LOG_DEBUG("Deleted voq neighbor %s from kernel", key.c_str());
 
-        it = consumer.m_toSync.erase(it);
+        consumer.m_toSync.erase(entries[i]);
+    }
+
+    entries.clear();
+    ip_addresses.clear();
+
+    bool intf_oper_up = (ibif_type != "port") || isIntfOperUp(nbr_odev);
+
+    it = consumer.m_toSync.begin();
+    while (it != consumer.m_toSync.end())
+    {
+        KeyOpFieldsValuesTuple t = it->second;
+        string key = kfvKey(t);
+
+        if (kfvOp(t) != SET_COMMAND)
+        {
+            it++;
+            continue;
+        }
+
+        if (!intf_oper_up)
+        {
+            SWSS_LOG_DEBUG("Device %s is not oper up, skipping system neigh %s'", nbr_odev.c_str(), key.c_str());
+            it++;
+            continue;
+        }
+
+        IpAddress ip_address(key.substr(key.find_last_of(state_db_key_delimiter)+1));
+        MacAddress mac_address;
+        for (auto i = kfvFieldsValues(t).begin();
+             i  != kfvFieldsValues(t).end(); i++)
+        {
+            if (fvField(*i) == "neigh")
+                mac_address = MacAddress(fvValue(*i));
+        }
+
+        if (!addKernelNeigh(nbr_odev, ip_address, mac_address))
+        {
+            SWSS_LOG_INFO("Neigh entry add on dev %s failed for '%s'", nbr_odev.c_str(), key.c_str());
+            // Delete neigh to take care of deletion of exiting nbr for mac change. This makes sure that
+            // re-try will be successful and route addtion (below) will be attempted and be successful
+            delKernelNeigh(nbr_odev, ip_address);
+            it++;
+            continue;
+        }
+        else
+        {
+            SWSS_LOG_NOTICE("Neigh entry added on dev %s for '%s'", nbr_odev.c_str(), key.c_str());
+        }
+
+        entries.push_back(it);
+        ip_addresses.push_back(ip_address);
+        it++;
+    }
+
+    addKernelRoutes(nbr_odev, ip_addresses, errors);
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        const string &key = kfvKey(entries[i]->second);
+
+        if (errors[i])
+        {
+            SWSS_LOG_INFO("Route entry add on dev %s failed for '%s'", nbr_odev.c_str(), key.c_str());
+            delKernelNeigh(nbr_odev, ip_addresses[i]);
+            // Delete route to take care of deletion of exiting route of nbr for mac change.
+            delKernelRoute(ip_addresses[i]);
+            continue;
+        }
+
+        SWSS_LOG_NOTICE("Route entry added on dev %s for '%s'", nbr_odev.c_str(), key.c_str());
+        SWSS_LOG_NOTICE("Added voq neighbor %s to kernel", key.c_str());
+
+        consumer.m_toSync.erase(entries[i]);
     }
 }
 
@@ -494,73 +669,121 @@ bool NbrMgr::getVoqInbandInterfaceName(string &ibif, string &type)
     return true;
 }
 
-bool NbrMgr::addKernelRoute(string odev, IpAddress ip_addr)
+/*
+ * Program the kernel host routes of the remote system neighbors, the
+ * equivalent of "ip route add <ip>/32 dev <odev>" and "ip route del <ip>/32",
+ * with the IPv6 routes added with metric 256. The requests are sent in
+ * batches on the netlink socket, each batch followed by the reading of its
+ * acks. errors[i] is 0 if the route of ip_addrs[i] is programmed, else the
+ * negative errno of the request.
+ */
+void NbrMgr::setKernelRoutes(uint16_t type, const string &odev, const vector<IpAddress> &ip_addrs, vector<int> &errors)
 {
-    string cmd, res;
-
     SWSS_LOG_ENTER();
 
-    string ip_str = ip_addr.to_string();
+    errors.assign(ip_addrs.size(), -EIO);
 
-    if(ip_addr.isV4())
+    if (ip_addrs.empty())
     {
-        cmd = string("") + IP_CMD + " route add " + ip_str + "/32 dev " + odev;
-        SWSS_LOG_NOTICE("IPv4 Route Add cmd: %s",cmd.c_str());
+        return;
     }
-    else
+
+    if (!m_nl_sock)
     {
-        // In voq system, We need the static route to the remote neighbor and connected
-        // route to have the same metric to enable BGP to choose paths from routes learned
-        // via eBGP and iBGP over the internal inband port be part of same ecmp group.
-        // For v4 both the metrics (connected and static) are default 0 so we do not need
-        // to set the metric explicitly.
-        cmd = string("") + IP_CMD + " -6 route add " + ip_str + "/128 dev " + odev + " metric 256";
-        SWSS_LOG_NOTICE("IPv6 Route Add cmd: %s",cmd.c_str());
+        SWSS_LOG_ERROR("Netlink socket null pointer");
+        return;
     }
 
-    int32_t ret = swss::exec(cmd, res);
-
-    if(ret)
+    int ifindex = 0;
+    if (type == RTM_NEWROUTE)
     {
-        /* This failure the caller expects is due to mac move */
-        SWSS_LOG_INFO("Failed to add route for %s, error: %d", ip_str.c_str(), ret);
-        return false;
+        ifindex = static_cast<int>(if_nametoindex(odev.c_str()));
+        if (!ifindex)
+        {
+            SWSS_LOG_ERROR("Failed to get ifindex of %s", odev.c_str());
+            errors.assign(ip_addrs.size(), -ENODEV);
+            return;
+        }
     }
 
-    SWSS_LOG_INFO("Added route for %s on device %s", ip_str.c_str(), odev.c_str());
-    return true;
+    for (size_t begin = 0; begin < ip_addrs.size(); begin += KERNEL_ROUTE_BATCH_SIZE)
+    {
+        size_t end = min(begin + KERNEL_ROUTE_BATCH_SIZE, ip_addrs.size());
+        map<uint32_t, size_t> pending;
+
+        for (size_t i = begin; i < end; i++)
+        {
+            struct nl_msg *msg = build_route_message(type, ifindex, ip_addrs[i]);
+            if (!msg)
+            {
+                SWSS_LOG_ERROR("Netlink route message alloc failed for '%s'", ip_addrs[i].to_string().c_str());
+                continue;
+            }
+
+            int err = nl_send_auto(m_nl_sock, msg);
+            if (err < 0)
+            {
+                SWSS_LOG_ERROR("Netlink send route message failed for '%s', error '%s'",
+                               ip_addrs[i].to_string().c_str(), nl_geterror(err));
+            }
+            else
+            {
+                pending.emplace(nlmsg_hdr(msg)->nlmsg_seq, i);
+            }
+            nlmsg_free(msg);
+        }
+
+        recv_acks(m_nl_sock, pending, errors);
+    }
 }
 
-bool NbrMgr::delKernelRoute(IpAddress ip_addr)
+void NbrMgr::addKernelRoutes(const string &odev, const vector<IpAddress> &ip_addrs, vector<int> &errors)
 {
-    string cmd, res;
-
     SWSS_LOG_ENTER();
 
-    string ip_str = ip_addr.to_string();
+    setKernelRoutes(RTM_NEWROUTE, odev, ip_addrs, errors);
 
-    if(ip_addr.isV4())
-    {
-        cmd = string("") + IP_CMD + " route del " + ip_str + "/32";
-        SWSS_LOG_NOTICE("IPv4 Route Del cmd: %s",cmd.c_str());
-    }
-    else
+    for (size_t i = 0; i < ip_addrs.size(); i++)
     {
-        cmd = string("") + IP_CMD + " -6 route del " + ip_str + "/128";
-        SWSS_LOG_NOTICE("IPv6 Route Del cmd: %s",cmd.c_str());
+        if (errors[i])
+        {
+            /* This failure the caller expects is due to mac move */
+            SWSS_LOG_INFO("Failed to add route for %s, error: %s", ip_addrs[i].to_string().c_str(), strerror(-errors[i]));
+        }
+        else
+        {
+            SWSS_LOG_INFO("Added route for %s on device %s", ip_addrs[i].to_string().c_str(), odev.c_str());
+        }
     }
+}
 
-    int32_t ret = swss::exec(cmd, res);
+void NbrMgr::delKernelRoutes(const vector<IpAddress> &ip_addrs, vector<int> &errors)
+{
+    SWSS_LOG_ENTER();
 
-    if(ret)
+    setKernelRoutes(RTM_DELROUTE, "", ip_addrs, errors);
+
+    for (size_t i = 0; i < ip_addrs.size(); i++)
     {
-        /* Just log error and return */
-        SWSS_LOG_ERROR("Failed to delete route for %s, error: %d", ip_str.c_str(), ret);
-        return false;
+        if (errors[i])
+        {
+            /* Just log error and return */
+            SWSS_LOG_ERROR("Failed to delete route for %s, error: %s", ip_addrs[i].to_string().c_str(), strerror(-errors[i]));
+        }
+        else
+        {
+            SWSS_LOG_INFO("Deleted route for %s", ip_addrs[i].to_string().c_str());
+        }
     }
+}
 
-    SWSS_LOG_INFO("Deleted route for %s", ip_str.c_str());
-    return true;
+bool NbrMgr::delKernelRoute(IpAddress ip_addr)
+{
+    vector<int> errors;
+
+    delKernelRoutes({ ip_addr }, errors);
+
+    return errors[0] == 0;
 }
 
 bool NbrMgr::addKernelNeigh(string odev, IpAddress ip_addr, MacAddress mac_addr)
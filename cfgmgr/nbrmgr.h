@@ -33,7 +33,9 @@ private:
     void doTask(Consumer &consumer);
     void doStateSystemNeighTask(Consumer &consumer);
     bool getVoqInbandInterfaceName(string &nbr_odev, string &ibiftype);
-    bool addKernelRoute(string odev, IpAddress ip_addr);
+    void setKernelRoutes(uint16_t type, const string &odev, const vector<IpAddress> &ip_addrs, vector<int> &errors);
+    void addKernelRoutes(const string &odev, const vector<IpAddress> &ip_addrs, vector<int> &errors);
+    void delKernelRoutes(const vector<IpAddress> &ip_addrs, vector<int> &errors);
     bool delKernelRoute(IpAddress ip_addr);
     bool addKernelNeigh(string odev, IpAddress ip_addr, MacAddress mac_addr);
     bool delKernelNeigh(string odev, IpAddress ip_addr);
@@ -19,17 +19,45 @@ using namespace std;
 using namespace swss;
 
 NeighSync::NeighSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConnector *cfgDb) :
-    m_neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME),
     m_stateNeighRestoreTable(stateDb, STATE_NEIGH_RESTORE_TABLE_NAME),
-    m_cfgInterfaceTable(cfgDb, CFG_INTF_TABLE_NAME),
-    m_cfgLagInterfaceTable(cfgDb, CFG_LAG_INTF_TABLE_NAME),
+    m_stateCountersTable(stateDb, STATE_NEIGH_SYNC_COUNTERS_TABLE_NAME),
+    m_neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME),
     m_cfgVlanInterfaceTable(cfgDb, CFG_VLAN_INTF_TABLE_NAME),
+    m_cfgLagInterfaceTable(cfgDb, CFG_LAG_INTF_TABLE_NAME),
+    m_cfgInterfaceTable(cfgDb, CFG_INTF_TABLE_NAME),
     m_cfgPeerSwitchTable(cfgDb, CFG_PEER_SWITCH_TABLE_NAME)
 {
     m_AppRestartAssist = new AppRestartAssist(pipelineAppDB, "neighsyncd", "swss", DEFAULT_NEIGHSYNC_WARMSTART_TIMER);
     if (m_AppRestartAssist)
     {
         m_AppRestartAssist->registerAppTable(APP_NEIGH_TABLE_NAME, &m_neighTable);
+        // Write new neighbors while the kernel dump is still processed
+        m_AppRestartAssist->setIncrementalReconcile(true);
+    }
+
+    // Load the current config, the config tables are then updated from the select loop
+    for (auto table : getCfgTables())
+    {
+        processCfgTable(table);
+    }
+
+    /*
+     * Load the neighbors left in NEIGH_TABLE by a previous instance of neighsyncd.
+     * In case of warm start, the cache is built from the replayed neighbors instead.
+     */
+    if (!m_AppRestartAssist->isWarmStartInProgress())
+    {
+        Table neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME, false);
+        vector<string> keys;
+        neighTable.getKeys(keys);
+        for (const auto &key : keys)
+        {
+            string mac;
+            if (neighTable.hget(key, "neigh", mac))
+            {
+                updateNeighCache(key, mac, false);
+            }
+        }
     }
 }
 
@@ -63,9 +91,7 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     string key;
     string family;
     string intfName;
-    std::vector<std::string> peerSwitchKeys;
-    m_cfgPeerSwitchTable.getKeys(peerSwitchKeys);
-    bool is_dualtor = peerSwitchKeys.size() > 0;
+    bool is_dualtor = !m_peerSwitches.empty();
 
     if ((nlmsg_type != RTM_NEWNEIGH) && (nlmsg_type != RTM_GETNEIGH) &&
         (nlmsg_type != RTM_DELNEIGH))
@@ -166,61 +192,146 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     if (m_AppRestartAssist->isWarmStartInProgress())
     {
         m_AppRestartAssist->insertToMap(APP_NEIGH_TABLE_NAME, key, fvVector, delete_key);
+        updateNeighCache(key, macStr, delete_key);
+        return;
     }
-    else
+
+    /*
+     * Only write the changes of the neighbor MAC, the NUD state transitions
+     * between REACHABLE, STALE, DELAY and PROBE don't change the entry.
+     */
+    auto found = m_neighCache.find(key);
+    if (delete_key == true)
     {
-        if (delete_key == true)
+        if (found == m_neighCache.end())
         {
-            m_neighTable.del(key);
+            m_suppressedDeletes++;
             return;
         }
-        m_neighTable.set(key, fvVector);
+        m_neighCache.erase(found);
+        m_neighTable.del(key);
+        m_updates++;
+        return;
+    }
+
+    MacAddress mac(macStr);
+    if (found != m_neighCache.end() && found->second == mac)
+    {
+        m_suppressedUpdates++;
+        return;
     }
+    updateNeighCache(key, macStr, false);
+    m_neighTable.set(key, fvVector);
+    m_updates++;
 }
 
-/* To check the ipv6 link local is enabled on a given port */
-bool NeighSync::isLinkLocalEnabled(const string &port)
+void NeighSync::updateNeighCache(const string &key, const string &mac, bool delete_key)
 {
-    vector<FieldValueTuple> values;
+    if (delete_key)
+    {
+        m_neighCache.erase(key);
+        return;
+    }
 
-    if (!port.compare(0, strlen("Vlan"), "Vlan"))
+    MacAddress macAddress(mac);
+    auto found = m_neighCache.find(key);
+    if (found != m_neighCache.end())
     {
-        if (!m_cfgVlanInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
+        found->second = macAddress;
     }
-    else if (!port.compare(0, strlen("PortChannel"), "PortChannel"))
+    else
     {
-        if (!m_cfgLagInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
+        m_neighCache.emplace(key, macAddress);
     }
-    else if (!port.compare(0, strlen("Ethernet"), "Ethernet"))
+}
+
+bool NeighSync::processCfgTable(Selectable *table)
+{
+    SubscriberStateTable *cfgTable = nullptr;
+    for (auto t : { &m_cfgVlanInterfaceTable, &m_cfgLagInterfaceTable, &m_cfgInterfaceTable, &m_cfgPeerSwitchTable })
     {
-        if (!m_cfgInterfaceTable.get(port, values))
+        if (table == t)
         {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
+            cfgTable = t;
         }
     }
-    else
+
+    if (cfgTable == nullptr)
     {
-        SWSS_LOG_INFO("IPv6 Link local is not supported for %s ", port.c_str());
         return false;
     }
 
-    auto it = std::find_if(values.begin(), values.end(), [](const FieldValueTuple& t){ return t.first == "ipv6_use_link_local_only";});
-    if (it != values.end())
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    cfgTable->pops(entries);
+
+    for (const auto &entry : entries)
     {
-        if (it->second == "enable")
+        const string &key = kfvKey(entry);
+
+        if (cfgTable == &m_cfgPeerSwitchTable)
+        {
+            if (kfvOp(entry) == SET_COMMAND)
+            {
+                m_peerSwitches.insert(key);
+            }
+            else
+            {
+                m_peerSwitches.erase(key);
+            }
+            continue;
+        }
+
+        // Skip the interface IP address entries
+        if (key.find('|') != string::npos)
+        {
+            continue;
+        }
+
+        bool enabled = false;
+        if (kfvOp(entry) == SET_COMMAND)
+        {
+            for (const auto &fv : kfvFieldsValues(entry))
+            {
+                if (fvField(fv) == "ipv6_use_link_local_only" && fvValue(fv) == "enable")
+                {
+                    enabled = true;
+                }
+            }
+        }
+
+        if (enabled)
         {
-            SWSS_LOG_INFO("IPv6 Link local is enabled on %s", port.c_str());
-            return true;
+            SWSS_LOG_INFO("IPv6 Link local is enabled on %s", key.c_str());
+            m_linkLocalEnabledIntfs.insert(key);
         }
+        else
+        {
+            m_linkLocalEnabledIntfs.erase(key);
+        }
+    }
+
+    return true;
+}
+
+void NeighSync::updateCounters()
+{
+    vector<FieldValueTuple> fvVector = {
+        { "neighbors", to_string(m_neighCache.size()) },
+        { "updates", to_string(m_updates) },
+        { "suppressed_updates", to_string(m_suppressedUpdates) },
+        { "suppressed_deletes", to_string(m_suppressedDeletes) }
+    };
+
+    m_stateCountersTable.set("neighsyncd", fvVector);
+}
+
+/* To check the ipv6 link local is enabled on a given port */
+bool NeighSync::isLinkLocalEnabled(const string &port)
+{
+    if (m_linkLocalEnabledIntfs.find(port) != m_linkLocalEnabledIntfs.end())
+    {
+        SWSS_LOG_INFO("IPv6 Link local is enabled on %s", port.c_str());
+        return true;
     }
 
     SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
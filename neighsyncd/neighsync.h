@@ -1,8 +1,13 @@
 #ifndef __NEIGHSYNC__
 #define __NEIGHSYNC__
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include "dbconnector.h"
 #include "producerstatetable.h"
+#include "subscriberstatetable.h"
+#include "macaddress.h"
 #include "netmsg.h"
 #include "warmRestartAssist.h"
 
@@ -16,6 +21,10 @@
  */
 #define RESTORE_NEIGH_WAIT_TIME_OUT 180
 
+// The interval (in seconds) of the neighsyncd counters update in STATE_DB
+#define NEIGHSYNC_COUNTERS_INTERVAL 10
+#define STATE_NEIGH_SYNC_COUNTERS_TABLE_NAME "NEIGH_SYNC_COUNTERS"
+
 namespace swss {
 
 class NeighSync : public NetMsg
@@ -35,13 +44,35 @@ public:
         return m_AppRestartAssist;
     }
 
+    std::vector<Selectable *> getCfgTables()
+    {
+        return { &m_cfgVlanInterfaceTable, &m_cfgLagInterfaceTable, &m_cfgInterfaceTable, &m_cfgPeerSwitchTable };
+    }
+
+    // Process the updates of a config table, return false if the selectable is not a config table
+    bool processCfgTable(Selectable *table);
+
+    void updateCounters();
+
 private:
-    Table m_stateNeighRestoreTable, m_cfgPeerSwitchTable;
+    Table m_stateNeighRestoreTable, m_stateCountersTable;
     ProducerStateTable m_neighTable;
     AppRestartAssist  *m_AppRestartAssist;
-    Table m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
+    SubscriberStateTable m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable, m_cfgPeerSwitchTable;
+
+    // Interfaces with ipv6_use_link_local_only enabled and peer switches, from CONFIG_DB
+    std::unordered_set<std::string> m_linkLocalEnabledIntfs;
+    std::unordered_set<std::string> m_peerSwitches;
+
+    // MAC of the neighbors in NEIGH_TABLE, by NEIGH_TABLE key
+    std::unordered_map<std::string, MacAddress> m_neighCache;
+
+    uint64_t m_updates = 0;
+    uint64_t m_suppressedUpdates = 0;
+    uint64_t m_suppressedDeletes = 0;
 
     bool isLinkLocalEnabled(const std::string &port);
+    void updateNeighCache(const std::string &key, const std::string &mac, bool delete_key);
 };
 
 }
@@ -4,6 +4,7 @@
 #include <chrono>
 #include "logger.h"
 #include "select.h"
+#include "selectabletimer.h"
 #include "netdispatcher.h"
 #include "netlink.h"
 #include "neighsyncd/neighsync.h"
@@ -31,6 +32,7 @@ int main(int argc, char **argv)
         {
             NetLink netlink;
             Select s;
+            SelectableTimer countersTimer(timespec{NEIGHSYNC_COUNTERS_INTERVAL, 0});
 
             using namespace std::chrono;
             /*
@@ -67,10 +69,25 @@ int main(int argc, char **argv)
             netlink.dumpRequest(RTM_GETNEIGH);
 
             s.addSelectable(&netlink);
+            for (auto table : sync.getCfgTables())
+            {
+                s.addSelectable(table);
+            }
+            countersTimer.start();
+            s.addSelectable(&countersTimer);
             while (true)
             {
                 Selectable *temps;
                 s.select(&temps);
+
+                if (temps == &countersTimer)
+                {
+                    sync.updateCounters();
+                }
+                else
+                {
+                    sync.processCfgTable(temps);
+                }
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
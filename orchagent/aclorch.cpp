@@ -3663,6 +3663,7 @@ AclOrch::AclOrch(vector<TableConnector>& connectors, DBConnector* stateDb, Switc
         PortsOrch *portOrch, MirrorOrch *mirrorOrch, NeighOrch *neighOrch, RouteOrch *routeOrch, DTelOrch *dtelOrch) :
         Orch(connectors),
         m_aclStageCapabilityTable(stateDb, STATE_ACL_STAGE_CAPABILITY_TABLE_NAME),
+        m_stateDb(stateDb),
         m_aclTableStateTable(stateDb, STATE_ACL_TABLE_TABLE_NAME),
         m_aclRuleStateTable(stateDb, STATE_ACL_RULE_TABLE_NAME),
         m_switchOrch(switchOrch),
@@ -5125,13 +5126,13 @@ void AclOrch::setAclTableStatus(string table_name, AclObjectStatus status)
 {
     vector<FieldValueTuple> fvVector;
     fvVector.emplace_back("status", aclObjectStatusLookup[status]);
-    m_aclTableStateTable.set(table_name, fvVector);
+    m_stateWriter.set(m_stateDb, m_aclTableStateTable.getTableName(), table_name, fvVector);
 }
 
 // Remove the status record of given ACL table from STATE_DB
 void AclOrch::removeAclTableStatus(string table_name)
 {
-    m_aclTableStateTable.del(table_name);
+    m_stateWriter.del(m_stateDb, m_aclTableStateTable.getTableName(), table_name);
 }
 
 // Set the status of ACL rule in STATE_DB
@@ -5139,13 +5140,13 @@ void AclOrch::setAclRuleStatus(string table_name, string rule_name, AclObjectSta
 {
     vector<FieldValueTuple> fvVector;
     fvVector.emplace_back("status", aclObjectStatusLookup[status]);
-    m_aclRuleStateTable.set(table_name + string("|") + rule_name, fvVector);
+    m_stateWriter.set(m_stateDb, m_aclRuleStateTable.getTableName(), table_name + string("|") + rule_name, fvVector);
 }
 
 // Remove the status record of given ACL rule from STATE_DB
 void AclOrch::removeAclRuleStatus(string table_name, string rule_name)
 {
-    m_aclRuleStateTable.del(table_name + string("|") + rule_name);
+    m_stateWriter.del(m_stateDb, m_aclRuleStateTable.getTableName(), table_name + string("|") + rule_name);
 }
 
 // Remove all ACL table status from STATE_DB
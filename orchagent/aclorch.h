@@ -587,6 +587,7 @@ private:
 
     Table m_aclStageCapabilityTable;
 
+    DBConnector *m_stateDb;
     Table m_aclTableStateTable;
     Table m_aclRuleStateTable;
 
@@ -128,7 +128,7 @@ void BfdOrch::doTask(Consumer &consumer)
                 }
                 else
                 {
-                    notify_session_state_down(key);
+                    notify_session_state_down({ key });
                 }
             }
             else
@@ -176,19 +176,31 @@ void BfdOrch::doTask(NotificationConsumer &consumer)
 {
     SWSS_LOG_ENTER();
 
-    std::string op;
-    std::string data;
-    std::vector<swss::FieldValueTuple> values;
-
-    consumer.pop(op, data, values);
-
     if (&consumer != m_bfdStateNotificationConsumer)
     {
         return;
     }
 
-    if (op == "bfd_session_state_change")
+    /*
+     * Drain all the pending notifications, so that the state changes of the
+     * sessions going down together, e.g. on a link failure, are delivered
+     * to the observers as a single batch.
+     */
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
+
+    std::vector<BfdUpdate> updates;
+
+    for (auto& entry : entries)
     {
+        const auto& op = kfvOp(entry);
+        const auto& data = kfvKey(entry);
+
+        if (op != "bfd_session_state_change")
+        {
+            continue;
+        }
+
         uint32_t count;
         sai_bfd_session_state_notification_t *bfdSessionState = nullptr;
 
@@ -212,7 +224,7 @@ void BfdOrch::doTask(NotificationConsumer &consumer)
                 BfdUpdate update;
                 update.peer = key;
                 update.state = state;
-                notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
+                updates.push_back(update);
 
                 bfd_session_lookup[id].state = state;
             }
@@ -220,6 +232,11 @@ void BfdOrch::doTask(NotificationConsumer &consumer)
 
         sai_deserialize_free_bfd_session_state_ntf(count, bfdSessionState);
     }
+
+    if (!updates.empty())
+    {
+        notify_session_state_changes(updates);
+    }
 }
 
 bool BfdOrch::register_bfd_state_change_notification(void)
@@ -524,7 +541,7 @@ bool BfdOrch::create_bfd_session(const string& key, const vector<FieldValueTuple
     BfdUpdate update;
     update.peer = state_db_key;
     update.state = SAI_BFD_SESSION_STATE_DOWN;
-    notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
+    notify_session_state_changes({ update });
 
     return true;
 }
@@ -610,45 +627,81 @@ uint32_t BfdOrch::bfd_src_port(void)
     return (port++);
 }
 
-void BfdOrch::notify_session_state_down(const string& key)
+void BfdOrch::notify_session_state_down(const vector<string>& keys)
 {
     SWSS_LOG_ENTER();
-    size_t found_vrf = key.find(delimiter);
-    if (found_vrf == string::npos)
+
+    vector<BfdUpdate> updates;
+
+    for (const auto& key : keys)
     {
-        SWSS_LOG_ERROR("Failed to parse key %s, no vrf is given", key.c_str());
-        return;
+        size_t found_vrf = key.find(delimiter);
+        if (found_vrf == string::npos)
+        {
+            SWSS_LOG_ERROR("Failed to parse key %s, no vrf is given", key.c_str());
+            continue;
+        }
+
+        size_t found_ifname = key.find(delimiter, found_vrf + 1);
+        if (found_ifname == string::npos)
+        {
+            SWSS_LOG_ERROR("Failed to parse key %s, no ifname is given", key.c_str());
+            continue;
+        }
+        string vrf_name = key.substr(0, found_vrf);
+        string alias = key.substr(found_vrf + 1, found_ifname - found_vrf - 1);
+        IpAddress peer_address(key.substr(found_ifname + 1));
+        BfdUpdate update;
+        update.peer = get_state_db_key(vrf_name, alias, peer_address);
+        update.state = SAI_BFD_SESSION_STATE_DOWN;
+        updates.push_back(update);
     }
 
-    size_t found_ifname = key.find(delimiter, found_vrf + 1);
-    if (found_ifname == string::npos)
+    if (!updates.empty())
     {
-        SWSS_LOG_ERROR("Failed to parse key %s, no ifname is given", key.c_str());
-        return;
+        notify_session_state_changes(updates);
     }
-    string vrf_name = key.substr(0, found_vrf);
-    string alias = key.substr(found_vrf + 1, found_ifname - found_vrf - 1);
-    IpAddress peer_address(key.substr(found_ifname + 1));
-    BfdUpdate update;
-    update.peer = get_state_db_key(vrf_name, alias, peer_address);
-    update.state = SAI_BFD_SESSION_STATE_DOWN;
-    notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
+}
+
+void BfdOrch::notify_session_state_changes(const vector<BfdUpdate>& updates)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto& update : updates)
+    {
+        BfdUpdate session_update = update;
+        notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&session_update));
+    }
+
+    BfdUpdateBatch batch;
+    batch.updates = updates;
+    notify(SUBJECT_TYPE_BFD_SESSION_STATE_BATCH_CHANGE, static_cast<void *>(&batch));
 }
 
 void BfdOrch::handleTsaStateChange(bool tsaState)
 {
     SWSS_LOG_ENTER();
-    for (auto it : bfd_session_cache)
+
+    if (tsaState == true)
     {
-        if (tsaState == true)
+        vector<string> keys;
+        for (auto it : bfd_session_cache)
         {
             if (bfd_session_map.find(it.first) != bfd_session_map.end())
             {
-                notify_session_state_down(it.first);
-                remove_bfd_session(it.first);
+                keys.push_back(it.first);
             }
         }
-        else
+
+        notify_session_state_down(keys);
+        for (const auto& key : keys)
+        {
+            remove_bfd_session(key);
+        }
+    }
+    else
+    {
+        for (auto it : bfd_session_cache)
         {
             if (bfd_session_map.find(it.first) == bfd_session_map.end())
             {
@@ -10,6 +10,17 @@ struct BfdUpdate
     sai_bfd_session_state_t state;
 };
 
+/*
+ * The session state changes handled together, in the order they happened.
+ * Observers that recompute shared state, like next hop groups, subscribe to
+ * the batch so that the state is recomputed once per batch, the per-session
+ * updates are still delivered to the other observers.
+ */
+struct BfdUpdateBatch
+{
+    std::vector<BfdUpdate> updates;
+};
+
 class BfdOrch: public Orch, public Subject
 {
 public:
@@ -27,7 +38,8 @@ private:
     uint32_t bfd_gen_id(void);
     uint32_t bfd_src_port(void);
 
-    void notify_session_state_down(const std::string& key);
+    void notify_session_state_down(const std::vector<std::string>& keys);
+    void notify_session_state_changes(const std::vector<BfdUpdate>& updates);
     bool register_bfd_state_change_notification(void);
     void update_port_number(std::vector<sai_attribute_t> &attrs);
     sai_status_t retry_create_bfd_session(sai_object_id_t &bfd_session_id, vector<sai_attribute_t> attrs);
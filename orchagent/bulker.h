@@ -338,8 +338,7 @@ struct SaiBulkerTraits<sai_next_hop_group_api_t>
     using set_entry_attribute_fn = sai_set_next_hop_group_member_attribute_fn;
     using bulk_create_entry_fn = sai_bulk_object_create_fn;
     using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
-    // TODO: wait until available in SAI
-    //using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
 };
 
 template<>
@@ -378,6 +377,7 @@ struct SaiBulkerTraits<sai_dash_vnet_api_t>
     using set_entry_attribute_fn = sai_set_vnet_attribute_fn;
     using bulk_create_entry_fn = sai_bulk_object_create_fn;
     using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
 };
 
 template<>
@@ -937,29 +937,30 @@ public:
         return *object_status;
     }
 
-    // TODO: wait until available in SAI
-    /*
-    sai_status_t set_entry_attribute(
+    void set_entry_attribute(
+        _Out_ sai_status_t *object_status,
         _In_ sai_object_id_t object_id,
         _In_ const sai_attribute_t *attr)
     {
-        auto found_setting = setting_entries.find(object_id);
-        if (found_setting != setting_entries.end())
-        {
-            // For simplicity, just insert new attribute at the vector end, no merging
-            found_setting->second.emplace_back(*attr);
-        }
-        else
-        {
-            // Create a new key if not exists in the map
-            setting_entries.emplace(std::piecewise_construct,
+        assert(object_status);
+        if (!object_status) throw std::invalid_argument("object_status is null");
+        assert(object_id != SAI_NULL_OBJECT_ID);
+        if (object_id == SAI_NULL_OBJECT_ID) throw std::invalid_argument("object_id is null");
+        assert(attr);
+        if (!attr) throw std::invalid_argument("attr is null");
+
+        // Insert or find the key (object_id)
+        auto& attrs = setting_entries.emplace(std::piecewise_construct,
                 std::forward_as_tuple(object_id),
-                std::forward_as_tuple(1, *attr));
-        }
+                std::forward_as_tuple()
+        ).first->second;
 
-        return SAI_STATUS_SUCCESS;
+        // Insert attr, the attributes of an object are set in order
+        attrs.emplace_back(std::piecewise_construct,
+                std::forward_as_tuple(*attr),
+                std::forward_as_tuple(object_status));
+        *object_status = SAI_STATUS_NOT_EXECUTED;
     }
-    */
 
     void flush()
     {
@@ -1015,33 +1016,51 @@ public:
         }
 
         // Setting
-        // TODO: wait until available in SAI
-        /*
         if (!setting_entries.empty())
         {
-            std::vector<sai_object_id_t> rs;
-            std::vector<sai_attribute_t> ts;
+            // A bulk call sets one attribute per object, so the attributes
+            // of an object are spread over consecutive bulk calls
+            size_t round = 0;
+            bool pending = true;
 
-            for (auto const& i: setting_entries)
+            while (pending)
             {
-                auto const& entry = i.first;
-                auto const& attrs = i.second;
-                for (auto const& attr: attrs)
+                std::vector<sai_object_id_t> rs;
+                std::vector<sai_attribute_t> ts;
+                std::vector<sai_status_t*> status_vector;
+
+                pending = false;
+                for (auto const& i: setting_entries)
                 {
-                    rs.push_back(entry);
-                    ts.push_back(attr);
+                    auto const& entry = i.first;
+                    auto const& attrs = i.second;
+                    if (round >= attrs.size())
+                    {
+                        continue;
+                    }
 
-                    if (rs.size() >= max_bulk_size)
+                    pending = pending || round + 1 < attrs.size();
+
+                    auto const& attr = attrs[round].first;
+                    sai_status_t *object_status = attrs[round].second;
+                    if (*object_status == SAI_STATUS_NOT_EXECUTED)
                     {
-                        flush_setting_entries(rs, ts);
+                        rs.push_back(entry);
+                        ts.push_back(attr);
+                        status_vector.push_back(object_status);
+
+                        if (rs.size() >= max_bulk_size)
+                        {
+                            flush_setting_entries(rs, ts, status_vector);
+                        }
                     }
                 }
+                flush_setting_entries(rs, ts, status_vector);
+                round++;
             }
-            flush_setting_entries(rs, ts);
 
             setting_entries.clear();
         }
-        */
     }
 
     void clear()
@@ -1089,11 +1108,11 @@ private:
     >>                                                      creating_entries;
 
     std::unordered_map<                                     // A map of
-            sai_object_id_t,                                // object_id -> (OUT object_status, attributes)
-            std::pair<
-                    sai_status_t *,
-                    std::vector<sai_attribute_t>
-            >
+            sai_object_id_t,                                // object_id -> [(attribute, OUT object_status)]
+            std::vector<std::pair<
+                    sai_attribute_t,
+                    sai_status_t *
+            >>
     >                                                       setting_entries;
 
                                                             // A map of
@@ -1102,8 +1121,9 @@ private:
 
     typename Ts::bulk_create_entry_fn                       create_entries;
     typename Ts::bulk_remove_entry_fn                       remove_entries;
-    // TODO: wait until available in SAI
-    //typename Ts::bulk_set_entry_attribute_fn                set_entries_attribute;
+    typename Ts::bulk_set_entry_attribute_fn                set_entries_attribute = nullptr;
+    // Used when the SAI implementation doesn't provide the bulk set
+    typename Ts::set_entry_attribute_fn                     set_entry_attribute_fn = nullptr;
 
     sai_status_t flush_removing_entries(
         _Inout_ std::vector<sai_object_id_t> &rs)
@@ -1174,11 +1194,10 @@ private:
         return status;
     }
 
-    // TODO: wait until available in SAI
-    /*
     sai_status_t flush_setting_entries(
         _Inout_ std::vector<sai_object_id_t> &rs,
-        _Inout_ std::vector<sai_attribute_t> &ts)
+        _Inout_ std::vector<sai_attribute_t> &ts,
+        _Inout_ std::vector<sai_status_t*> &status_vector)
     {
         if (rs.empty())
         {
@@ -1186,8 +1205,31 @@ private:
         }
         size_t count = rs.size();
         std::vector<sai_status_t> statuses(count);
-        sai_status_t status = (*set_entries_attribute)((uint32_t)count, rs.data(), ts.data()
-            , SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+        if (set_entries_attribute)
+        {
+            status = (*set_entries_attribute)((uint32_t)count, rs.data(), ts.data()
+                , SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+            if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+            {
+                SWSS_LOG_NOTICE("ObjectBulker bulk set is not supported, falling back to single sets");
+                set_entries_attribute = nullptr;
+            }
+        }
+
+        if (!set_entries_attribute)
+        {
+            status = SAI_STATUS_SUCCESS;
+            for (size_t ir = 0; ir < count; ir++)
+            {
+                statuses[ir] = (*set_entry_attribute_fn)(rs[ir], &ts[ir]);
+                if (statuses[ir] != SAI_STATUS_SUCCESS)
+                {
+                    status = SAI_STATUS_FAILURE;
+                }
+            }
+        }
+
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("ObjectBulker.flush setting_entries %zu\n", count);
@@ -1198,12 +1240,17 @@ private:
                             count, sai_serialize_status(status).c_str());
         }
 
+        for (size_t ir = 0; ir < count; ir++)
+        {
+            *status_vector[ir] = statuses[ir];
+        }
+
         rs.clear();
         ts.clear();
+        status_vector.clear();
 
         return status;
     }
-     */
 };
 
 template <>
@@ -1213,8 +1260,8 @@ inline ObjectBulker<sai_next_hop_group_api_t>::ObjectBulker(SaiBulkerTraits<sai_
 {
     create_entries = api->create_next_hop_group_members;
     remove_entries = api->remove_next_hop_group_members;
-    // TODO: wait until available in SAI
-    //set_entries_attribute = ;
+    set_entries_attribute = api->set_next_hop_group_members_attribute;
+    set_entry_attribute_fn = api->set_next_hop_group_member_attribute;
 }
 
 template <>
@@ -1224,4 +1271,5 @@ inline ObjectBulker<sai_dash_vnet_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_
 {
     create_entries = api->create_vnets;
     remove_entries = api->remove_vnets;
+    set_entry_attribute_fn = api->set_vnet_attribute;
 }
@@ -2,6 +2,7 @@
 #include "copporch.h"
 #include "portsorch.h"
 #include "flexcounterorch.h"
+#include "counterrateorch.h"
 #include "tokenize.h"
 #include "logger.h"
 #include "sai_serialize.h"
@@ -27,6 +28,7 @@ extern PortsOrch*           gPortsOrch;
 extern Directory<Orch*>     gDirectory;
 extern bool                 gIsNatSupported;
 extern bool                 gTraditionalFlexCounter;
+extern bool                 gCounterRatesInOrch;
 
 #define FLEX_COUNTER_UPD_INTERVAL 1
 
@@ -1203,7 +1205,7 @@ void CoppOrch::initTrapRatePlugin()
         return;
     }
 
-    std::string trapRatePluginName = "trap_rates.lua";
+    std::string trapRatePluginName = gCounterRatesInOrch ? COUNTER_RATES_POLL_PLUGIN : "trap_rates.lua";
     std::string trapSha;
     try
     {
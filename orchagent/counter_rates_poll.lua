@@ -0,0 +1,14 @@
+-- KEYS - IDs of the objects polled by the flex counter group
+-- ARGV[1] - counters db index
+-- ARGV[2] - counters table name
+-- ARGV[3] - poll time interval
+-- return nothing
+
+-- Notify orchagent that the counters of the group were polled, as
+-- ["<first object id>","<poll interval>"], for it to update their rates
+
+if #KEYS == 0 then
+    return
+end
+
+redis.call('PUBLISH', 'COUNTER_RATES_POLL', '["' .. KEYS[1] .. '","' .. ARGV[3] .. '"]')
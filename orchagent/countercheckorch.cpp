@@ -56,7 +56,7 @@ void CounterCheckOrch::mcCounterCheck()
     {
         auto oid = i.first;
         auto mcCounters = i.second;
-        uint8_t pfcMask = 0;
+        uint8_t pfcMask = m_pfcMaskMap[oid];
 
         Port port;
         if (!gPortsOrch->getPort(oid, port))
@@ -67,13 +67,7 @@ void CounterCheckOrch::mcCounterCheck()
 
         auto newMcCounters = getQueueMcCounters(port);
 
-        if (!gPortsOrch->getPortPfc(port.m_port_id, &pfcMask))
-        {
-            SWSS_LOG_ERROR("Failed to get PFC mask on port %s", port.m_alias.c_str());
-            continue;
-        }
-
-        for (size_t prio = 0; prio != mcCounters.size(); prio++)
+        for (size_t prio = 0; prio != min(mcCounters.size(), newMcCounters.size()); prio++)
         {
             bool isLossy = ((1 << prio) & pfcMask) == 0;
             if (newMcCounters[prio] == numeric_limits<uint64_t>::max())
@@ -104,7 +98,7 @@ void CounterCheckOrch::pfcFrameCounterCheck()
         auto oid = i.first;
         auto counters = i.second;
         auto newCounters = getPfcFrameCounters(oid);
-        uint8_t pfcMask = 0;
+        uint8_t pfcMask = m_pfcMaskMap[oid];
 
         Port port;
         if (!gPortsOrch->getPort(oid, port))
@@ -113,12 +107,6 @@ void CounterCheckOrch::pfcFrameCounterCheck()
             continue;
         }
 
-        if (!gPortsOrch->getPortPfc(port.m_port_id, &pfcMask))
-        {
-            SWSS_LOG_ERROR("Failed to get PFC mask on port %s", port.m_alias.c_str());
-            continue;
-        }
-
         for (size_t prio = 0; prio != counters.size(); prio++)
         {
             bool isLossy = ((1 << prio) & pfcMask) == 0;
@@ -185,6 +173,28 @@ PfcFrameCounters CounterCheckOrch::getPfcFrameCounters(sai_object_id_t portId)
     return counters;
 }
 
+bool CounterCheckOrch::isMcQueue(const string& queueIdStr)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_mcQueueCache.find(queueIdStr);
+    if (it != m_mcQueueCache.end())
+    {
+        return it->second;
+    }
+
+    // The type of a queue doesn't change, it is only read until the queue counters are created
+    auto queueType = m_countersDb->hget(COUNTERS_QUEUE_TYPE_MAP, queueIdStr);
+    if (queueType.get() == nullptr)
+    {
+        return false;
+    }
+
+    bool isMc = *queueType == "SAI_QUEUE_TYPE_MULTICAST";
+    m_mcQueueCache.emplace(queueIdStr, isMc);
+    return isMc;
+}
+
 QueueMcCounters CounterCheckOrch::getQueueMcCounters(
         const Port& port)
 {
@@ -197,9 +207,8 @@ QueueMcCounters CounterCheckOrch::getQueueMcCounters(
     {
         sai_object_id_t queueId = port.m_queue_ids[prio];
         auto queueIdStr = sai_serialize_object_id(queueId);
-        auto queueType = m_countersDb->hget(COUNTERS_QUEUE_TYPE_MAP, queueIdStr);
 
-        if (queueType.get() == nullptr || *queueType != "SAI_QUEUE_TYPE_MULTICAST" || !m_countersTable->get(queueIdStr, fieldValues))
+        if (!isMcQueue(queueIdStr) || !m_countersTable->get(queueIdStr, fieldValues))
         {
             continue;
         }
@@ -225,10 +234,26 @@ void CounterCheckOrch::addPort(const Port& port)
 {
     m_mcCountersMap.emplace(port.m_port_id, getQueueMcCounters(port));
     m_pfcFrameCountersMap.emplace(port.m_port_id, getPfcFrameCounters(port.m_port_id));
+    m_pfcMaskMap[port.m_port_id] = port.m_pfc_bitmask;
 }
 
 void CounterCheckOrch::removePort(const Port& port)
 {
     m_mcCountersMap.erase(port.m_port_id);
     m_pfcFrameCountersMap.erase(port.m_port_id);
+    m_pfcMaskMap.erase(port.m_port_id);
+
+    for (const auto& queueId : port.m_queue_ids)
+    {
+        m_mcQueueCache.erase(sai_serialize_object_id(queueId));
+    }
+}
+
+void CounterCheckOrch::updatePortPfc(sai_object_id_t portId, uint8_t pfcMask)
+{
+    auto it = m_pfcMaskMap.find(portId);
+    if (it != m_pfcMaskMap.end())
+    {
+        it->second = pfcMask;
+    }
 }
@@ -5,6 +5,7 @@
 #include "port.h"
 #include "timer.h"
 #include <array>
+#include <unordered_map>
 
 #define PFC_WD_TC_MAX 8
 
@@ -23,17 +24,22 @@ public:
     virtual void doTask(Consumer &consumer) {}
     void addPort(const swss::Port& port);
     void removePort(const swss::Port& port);
+    void updatePortPfc(sai_object_id_t portId, uint8_t pfcMask);
 
 private:
     CounterCheckOrch(swss::DBConnector *db, std::vector<std::string> &tableNames);
     virtual ~CounterCheckOrch(void);
     QueueMcCounters getQueueMcCounters(const swss::Port& port);
     PfcFrameCounters getPfcFrameCounters(sai_object_id_t portId);
+    bool isMcQueue(const std::string& queueIdStr);
     void mcCounterCheck();
     void pfcFrameCounterCheck();
 
     std::map<sai_object_id_t, QueueMcCounters> m_mcCountersMap;
     std::map<sai_object_id_t, PfcFrameCounters> m_pfcFrameCountersMap;
+    std::map<sai_object_id_t, uint8_t> m_pfcMaskMap;
+    // Whether a queue is multicast, for the queues found in COUNTERS_QUEUE_TYPE_MAP
+    std::unordered_map<std::string, bool> m_mcQueueCache;
 
     std::shared_ptr<swss::DBConnector> m_countersDb = nullptr;
     std::shared_ptr<swss::Table> m_countersTable = nullptr;
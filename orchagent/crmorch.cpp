@@ -371,6 +371,8 @@ CrmOrch::CrmOrch(DBConnector *db, string tableName):
     Orch(db, tableName),
     m_countersDb(new DBConnector("COUNTERS_DB", 0)),
     m_countersCrmTable(new Table(m_countersDb.get(), COUNTERS_CRM_TABLE)),
+    m_countersPipeline(new RedisPipeline(m_countersDb.get())),
+    m_countersCrmPipelineTable(new Table(m_countersPipeline.get(), COUNTERS_CRM_TABLE, true)),
     m_timer(new SelectableTimer(timespec { .tv_sec = CRM_POLLING_INTERVAL_DEFAULT, .tv_nsec = 0 }))
 {
     SWSS_LOG_ENTER();
@@ -382,6 +384,15 @@ CrmOrch::CrmOrch(DBConnector *db, string tableName):
         m_resourcesMap.emplace(res.first, CrmResourceEntry(res.second, CRM_THRESHOLD_TYPE_DEFAULT, CRM_THRESHOLD_LOW_DEFAULT, CRM_THRESHOLD_HIGH_DEFAULT));
     }
 
+    // Resource types are contiguous starting from 0, so they can address the handles directly
+    size_t resourceCount = static_cast<size_t>(m_resourcesMap.rbegin()->first) + 1;
+    m_resourceEntries.assign(resourceCount, nullptr);
+    m_resourceStatsCounters.assign(resourceCount, nullptr);
+    for (auto &res : m_resourcesMap)
+    {
+        m_resourceEntries[static_cast<size_t>(res.first)] = &res.second;
+    }
+
     // The CRM stats needs to be populated again
     m_countersCrmTable->del(CRM_COUNTERS_TABLE_KEY);
 
@@ -511,34 +522,51 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
     }
 }
 
-void CrmOrch::incCrmResUsedCounter(CrmResourceType resource)
+CrmOrch::CrmResourceCounter *CrmOrch::getResStatsCounter(CrmResourceType resource)
 {
-    SWSS_LOG_ENTER();
+    auto index = static_cast<size_t>(resource);
+    if (index >= m_resourceStatsCounters.size())
+    {
+        return nullptr;
+    }
 
-    try
+    auto *cnt = m_resourceStatsCounters[index];
+    if (cnt == nullptr)
     {
-        m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter++;
+        // The "STATS" counter is never removed, so the handle stays valid once created
+        cnt = &m_resourceEntries[index]->countersMap[CRM_COUNTERS_TABLE_KEY];
+        m_resourceStatsCounters[index] = cnt;
     }
-    catch (...)
+
+    return cnt;
+}
+
+void CrmOrch::incCrmResUsedCounter(CrmResourceType resource)
+{
+    SWSS_LOG_ENTER();
+
+    auto *cnt = getResStatsCounter(resource);
+    if (cnt == nullptr)
     {
-        SWSS_LOG_ERROR("Failed to increment \"used\" counter for the %s CRM resource.", crmResTypeNameMap.at(resource).c_str());
+        SWSS_LOG_ERROR("Failed to increment \"used\" counter for the CRM resource %u.", static_cast<uint32_t>(resource));
         return;
     }
+
+    cnt->usedCounter++;
 }
 
 void CrmOrch::decCrmResUsedCounter(CrmResourceType resource)
 {
     SWSS_LOG_ENTER();
 
-    try
+    auto *cnt = getResStatsCounter(resource);
+    if (cnt == nullptr)
     {
-        m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter--;
-    }
-    catch (...)
-    {
-        SWSS_LOG_ERROR("Failed to decrement \"used\" counter for the %s CRM resource.", crmResTypeNameMap.at(resource).c_str());
+        SWSS_LOG_ERROR("Failed to decrement \"used\" counter for the CRM resource %u.", static_cast<uint32_t>(resource));
         return;
     }
+
+    cnt->usedCounter--;
 }
 
 void CrmOrch::incCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t stage, sai_acl_bind_point_type_t point)
@@ -585,7 +613,8 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
             }
 
             // remove ACL_TABLE_STATS in crm database
-            m_countersCrmTable->del(getCrmAclTableKey(oid));
+            delCrmCountersTableKey(getCrmAclTableKey(oid));
+            m_crmAclTableKeys.erase(oid);
         }
     }
     catch (...)
@@ -601,8 +630,9 @@ void CrmOrch::incCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter++;
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].id = tableId;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)];
+        cnt.usedCounter++;
+        cnt.id = tableId;
     }
     catch (...)
     {
@@ -699,13 +729,13 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
         {
             decCrmResUsedCounter(resource);
             m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE).countersMap.erase(getCrmDashAclGroupKey(tableId));
-            m_countersCrmTable->del(getCrmDashAclGroupKey(tableId));
+            delCrmCountersTableKey(getCrmDashAclGroupKey(tableId));
         }
         else if (resource == CrmResourceType::CRM_DASH_IPV6_ACL_GROUP)
         {
             decCrmResUsedCounter(resource);
             m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV6_ACL_RULE).countersMap.erase(getCrmDashAclGroupKey(tableId));
-            m_countersCrmTable->del(getCrmDashAclGroupKey(tableId));
+            delCrmCountersTableKey(getCrmDashAclGroupKey(tableId));
         }
         else 
         {
@@ -1015,12 +1045,14 @@ void CrmOrch::updateCrmCountersTable()
 {
     SWSS_LOG_ENTER();
 
-    // Update CRM used counters in COUNTERS_DB
-    for (const auto &i : crmUsedCntsTableMap)
+    // Collect the counters changed since the last poll, grouped by COUNTERS_DB key
+    map<string, vector<FieldValueTuple>> updates;
+
+    auto collect = [&](const map<string, CrmResourceType> &cntsTableMap, bool used)
     {
-        try
+        for (const auto &i : cntsTableMap)
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            const auto &res = *m_resourceEntries[static_cast<size_t>(i.second)];
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
@@ -1028,40 +1060,45 @@ void CrmOrch::updateCrmCountersTable()
 
             for (const auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.usedCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                uint32_t value = used ? cnt.second.usedCounter : cnt.second.availableCounter;
+                auto &publishedFields = m_publishedCounters[cnt.first];
+                auto published = publishedFields.find(i.first);
+                if (published != publishedFields.end() && published->second == value)
+                {
+                    continue;
+                }
+
+                publishedFields[i.first] = value;
+                updates[cnt.first].emplace_back(i.first, to_string(value));
             }
         }
-        catch(const out_of_range &e)
-        {
-            // expected when a resource is unavailable
-        }
-    }
+    };
 
+    // Update CRM used counters in COUNTERS_DB
+    collect(crmUsedCntsTableMap, true);
     // Update CRM available counters in COUNTERS_DB
-    for (const auto &i : crmAvailCntsTableMap)
+    collect(crmAvailCntsTableMap, false);
+
+    if (updates.empty())
     {
-        try
-        {
-            const auto &res = m_resourcesMap.at(i.second);
-            if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
-            {
-                continue;
-            }
+        return;
+    }
 
-            for (const auto &cnt : res.countersMap)
-            {
-                FieldValueTuple attr(i.first, to_string(cnt.second.availableCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
-            }
-        }
-        catch(const out_of_range &e)
-        {
-            // expected when a resource is unavailable
-        }
+    for (const auto &update : updates)
+    {
+        m_countersCrmPipelineTable->set(update.first, update.second);
     }
+    m_countersCrmPipelineTable->flush();
+
+    SWSS_LOG_INFO("Updated %zu CRM keys in COUNTERS_DB", updates.size());
+}
+
+void CrmOrch::delCrmCountersTableKey(const string &key)
+{
+    SWSS_LOG_ENTER();
+
+    m_countersCrmTable->del(key);
+    m_publishedCounters.erase(key);
 }
 
 void CrmOrch::checkCrmThresholds()
@@ -1141,51 +1178,57 @@ void CrmOrch::checkCrmThresholds()
 }
 
 
-string CrmOrch::getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint)
+const string &CrmOrch::getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint)
 {
-    string key = "ACL_STATS";
-
-    switch(stage)
+    static const string invalidKey;
+    static const map<pair<sai_acl_stage_t, sai_acl_bind_point_type_t>, string> crmAclKeys = []()
     {
-        case SAI_ACL_STAGE_INGRESS:
-            key += ":INGRESS";
-            break;
-        case SAI_ACL_STAGE_EGRESS:
-            key += ":EGRESS";
-            break;
-        default:
-            return "";
-    }
+        const map<sai_acl_stage_t, string> stages =
+        {
+            { SAI_ACL_STAGE_INGRESS, ":INGRESS" },
+            { SAI_ACL_STAGE_EGRESS, ":EGRESS" }
+        };
+        const map<sai_acl_bind_point_type_t, string> bindPoints =
+        {
+            { SAI_ACL_BIND_POINT_TYPE_PORT, ":PORT" },
+            { SAI_ACL_BIND_POINT_TYPE_LAG, ":LAG" },
+            { SAI_ACL_BIND_POINT_TYPE_VLAN, ":VLAN" },
+            { SAI_ACL_BIND_POINT_TYPE_ROUTER_INTERFACE, ":RIF" },
+            { SAI_ACL_BIND_POINT_TYPE_SWITCH, ":SWITCH" }
+        };
+
+        map<pair<sai_acl_stage_t, sai_acl_bind_point_type_t>, string> keys;
+        for (const auto &stage : stages)
+        {
+            for (const auto &bindPoint : bindPoints)
+            {
+                keys[{ stage.first, bindPoint.first }] = "ACL_STATS" + stage.second + bindPoint.second;
+            }
+        }
+
+        return keys;
+    }();
 
-    switch(bindPoint)
+    auto it = crmAclKeys.find({ stage, bindPoint });
+    if (it == crmAclKeys.end())
     {
-        case SAI_ACL_BIND_POINT_TYPE_PORT:
-            key += ":PORT";
-            break;
-        case SAI_ACL_BIND_POINT_TYPE_LAG:
-            key += ":LAG";
-            break;
-        case SAI_ACL_BIND_POINT_TYPE_VLAN:
-            key += ":VLAN";
-            break;
-        case SAI_ACL_BIND_POINT_TYPE_ROUTER_INTERFACE:
-            key += ":RIF";
-            break;
-        case SAI_ACL_BIND_POINT_TYPE_SWITCH:
-            key += ":SWITCH";
-            break;
-        default:
-            return "";
+        return invalidKey;
     }
 
-    return key;
+    return it->second;
 }
 
-string CrmOrch::getCrmAclTableKey(sai_object_id_t id)
+const string &CrmOrch::getCrmAclTableKey(sai_object_id_t id)
 {
+    auto it = m_crmAclTableKeys.find(id);
+    if (it != m_crmAclTableKeys.end())
+    {
+        return it->second;
+    }
+
     std::stringstream ss;
     ss << "ACL_TABLE_STATS:" << "0x" << std::hex << id;
-    return ss.str();
+    return m_crmAclTableKeys.emplace(id, ss.str()).first->second;
 }
 
 string CrmOrch::getCrmP4rtTableKey(std::string table_name)
@@ -3,6 +3,7 @@
 #include <thread>
 #include <chrono>
 #include <map>
+#include <unordered_map>
 #include "orch.h"
 #include "port.h"
 #include "events.h"
@@ -92,6 +93,8 @@ public:
 private:
     std::shared_ptr<swss::DBConnector> m_countersDb = nullptr;
     std::shared_ptr<swss::Table> m_countersCrmTable = nullptr;
+    std::shared_ptr<swss::RedisPipeline> m_countersPipeline = nullptr;
+    std::shared_ptr<swss::Table> m_countersCrmPipelineTable = nullptr;
     swss::SelectableTimer *m_timer = nullptr;
 
     struct CrmResourceCounter
@@ -121,16 +124,29 @@ private:
 
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
 
+    // Index-addressed handles to the entries of m_resourcesMap and to their global "STATS" counters,
+    // used on the hot path instead of looking the resource and the counter key up by string
+    std::vector<CrmResourceEntry *> m_resourceEntries;
+    std::vector<CrmResourceCounter *> m_resourceStatsCounters;
+
+    // Cache of ACL_TABLE_STATS keys per ACL table
+    std::unordered_map<sai_object_id_t, std::string> m_crmAclTableKeys;
+
+    // Counters published to COUNTERS_DB at the last poll, key -> field -> value
+    std::map<std::string, std::map<std::string, uint32_t>> m_publishedCounters;
+
     void doTask(Consumer &consumer);
     void handleSetCommand(const std::string& key, const std::vector<swss::FieldValueTuple>& data);
     void doTask(swss::SelectableTimer &timer);
     bool getResAvailability(CrmResourceType type, CrmResourceEntry &res);
     bool getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res);
     void getResAvailableCounters();
+    CrmResourceCounter *getResStatsCounter(CrmResourceType resource);
     void updateCrmCountersTable();
+    void delCrmCountersTableKey(const std::string &key);
     void checkCrmThresholds();
-    std::string getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint);
-    std::string getCrmAclTableKey(sai_object_id_t id);
+    const std::string &getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint);
+    const std::string &getCrmAclTableKey(sai_object_id_t id);
     std::string getCrmP4rtTableKey(std::string table_name);
     std::string getCrmDashAclGroupKey(sai_object_id_t id);
 };
@@ -88,8 +88,12 @@ FabricPortsOrch::FabricPortsOrch(DBConnector *appl_db, vector<table_name_with_pr
     SWSS_LOG_NOTICE( "FabricPortsOrch constructor" );
 
     m_state_db = shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
-    m_stateTable = unique_ptr<Table>(new Table(m_state_db.get(), APP_FABRIC_PORT_TABLE_NAME));
-    m_fabricCapacityTable = unique_ptr<Table>(new Table(m_state_db.get(), STATE_FABRIC_CAPACITY_TABLE_NAME));
+    // The monitor writes many fields per lane every poll, they are sent to
+    // STATE_DB in one pipeline flushed at the end of each task
+    m_statePipeline = unique_ptr<RedisPipeline>(new RedisPipeline(m_state_db.get()));
+    m_stateTable = unique_ptr<Table>(new Table(m_statePipeline.get(), APP_FABRIC_PORT_TABLE_NAME, true));
+    m_fabricCapacityTable = unique_ptr<Table>(new Table(m_statePipeline.get(), STATE_FABRIC_CAPACITY_TABLE_NAME, true));
+    m_fabricMonitorStatsTable = unique_ptr<Table>(new Table(m_statePipeline.get(), STATE_FABRIC_MONITOR_STATS_TABLE_NAME, true));
 
     m_counter_db = shared_ptr<DBConnector>(new DBConnector("COUNTERS_DB", 0));
     m_portNameQueueCounterTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_FABRIC_QUEUE_NAME_MAP));
@@ -320,15 +324,66 @@ void FabricPortsOrch::generateQueueStats()
     m_isQueueStatsGenerated = true;
 }
 
+/*
+ * Query the attributes of the fabric ports, attrIds.size() attributes per
+ * port, with a single bulk get when the SAI supports it, else with one get per
+ * port. The attributes of ports[i] are returned in attrs starting at
+ * i * attrIds.size(), with the status of the query in statuses[i].
+ */
+void FabricPortsOrch::getPortsAttributes(const vector<sai_object_id_t>& ports, const vector<sai_attr_id_t>& attrIds,
+                                         vector<sai_attribute_t>& attrs, vector<sai_status_t>& statuses)
+{
+    SWSS_LOG_ENTER();
+
+    const uint32_t attr_count = static_cast<uint32_t>(attrIds.size());
+    size_t count = ports.size();
+
+    vector<uint32_t> attr_counts(count, attr_count);
+    vector<sai_attribute_t *> attr_lists(count);
+    attrs.assign(count * attr_count, sai_attribute_t());
+    statuses.assign(count, SAI_STATUS_NOT_EXECUTED);
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        attr_lists[i] = &attrs[i * attr_count];
+        for (uint32_t j = 0; j < attr_count; j++)
+        {
+            attr_lists[i][j].id = attrIds[j];
+        }
+    }
+
+    if (m_bulkPortGetSupported && sai_port_api->get_ports_attribute != nullptr)
+    {
+        sai_status_t status = sai_port_api->get_ports_attribute(static_cast<uint32_t>(count), ports.data(),
+                attr_counts.data(), attr_lists.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+        {
+            SWSS_LOG_NOTICE("Bulk get of fabric port attributes is not supported, querying ports one by one");
+            m_bulkPortGetSupported = false;
+            statuses.assign(count, SAI_STATUS_NOT_EXECUTED);
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (statuses[i] == SAI_STATUS_NOT_EXECUTED)
+        {
+            statuses[i] = sai_port_api->get_port_attribute(ports[i], attr_count, attr_lists[i]);
+        }
+    }
+}
+
 void FabricPortsOrch::updateFabricPortState()
 {
     if (!m_getFabricPortListDone) return;
 
     SWSS_LOG_ENTER();
 
-    sai_status_t status;
-    sai_attribute_t attr;
-
     time_t now;
     struct timespec time_now;
     if (clock_gettime(CLOCK_MONOTONIC, &time_now) < 0)
@@ -337,18 +392,28 @@ void FabricPortsOrch::updateFabricPortState()
     }
     now = time_now.tv_sec;
 
+    vector<int> lanes;
+    vector<sai_object_id_t> ports;
+    lanes.reserve(m_fabricLanePortMap.size());
+    ports.reserve(m_fabricLanePortMap.size());
     for (auto p : m_fabricLanePortMap)
     {
-        int lane = p.first;
-        sai_object_id_t port = p.second;
+        lanes.push_back(p.first);
+        ports.push_back(p.second);
+    }
 
-        string key = FABRIC_PORT_PREFIX + to_string(lane);
-        std::vector<FieldValueTuple> values;
-        uint32_t remote_peer = 0;
-        uint32_t remote_port = 0;
+    // The attachment of all the lanes is queried at once, then the remote
+    // switch and port of the attached lanes.
+    vector<sai_attribute_t> attachedAttrs;
+    vector<sai_status_t> attachedStatuses;
+    getPortsAttributes(ports, { SAI_PORT_ATTR_FABRIC_ATTACHED }, attachedAttrs, attachedStatuses);
+
+    size_t count = lanes.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        int lane = lanes[i];
+        sai_status_t status = attachedStatuses[i];
 
-        attr.id = SAI_PORT_ATTR_FABRIC_ATTACHED;
-        status = sai_port_api->get_port_attribute(port, 1, &attr);
         if (status != SAI_STATUS_SUCCESS)
         {
             // Port may not be ready for query
@@ -356,43 +421,84 @@ void FabricPortsOrch::updateFabricPortState()
             task_process_status handle_status = handleSaiGetStatus(SAI_API_PORT, status);
             if (handle_status != task_process_status::task_success)
             {
-                return;
+                // Only the lanes before the failed one are updated
+                count = i;
+                break;
             }
         }
 
+        bool attached = attachedAttrs[i].value.booldata;
         if (m_portStatus.find(lane) != m_portStatus.end() &&
-            m_portStatus[lane] && !attr.value.booldata)
+            m_portStatus[lane] && !attached)
         {
             m_portDownCount[lane] ++;
             m_portDownSeenLastTime[lane] = now;
         }
-        m_portStatus[lane] = attr.value.booldata;
+        m_portStatus[lane] = attached;
+    }
+
+    vector<sai_object_id_t> attachedPorts;
+    vector<size_t> attachedIndexes(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (m_portStatus[lanes[i]])
+        {
+            attachedIndexes[i] = attachedPorts.size();
+            attachedPorts.push_back(ports[i]);
+        }
+    }
+
+    vector<sai_attribute_t> remoteAttrs;
+    vector<sai_status_t> remoteStatuses;
+    getPortsAttributes(attachedPorts,
+                       { SAI_PORT_ATTR_FABRIC_ATTACHED_SWITCH_ID, SAI_PORT_ATTR_FABRIC_ATTACHED_PORT_INDEX },
+                       remoteAttrs, remoteStatuses);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        int lane = lanes[i];
+
+        string key = FABRIC_PORT_PREFIX + to_string(lane);
+        std::vector<FieldValueTuple> values;
+        uint32_t remote_peer = 0;
+        uint32_t remote_port = 0;
 
         if (m_portStatus[lane])
         {
-            attr.id = SAI_PORT_ATTR_FABRIC_ATTACHED_SWITCH_ID;
-            status = sai_port_api->get_port_attribute(port, 1, &attr);
-            if (status != SAI_STATUS_SUCCESS)
+            size_t index = attachedIndexes[i];
+            if (remoteStatuses[index] == SAI_STATUS_SUCCESS)
             {
-                task_process_status handle_status = handleSaiGetStatus(SAI_API_PORT, status);
-                if (handle_status != task_process_status::task_success)
+                remote_peer = remoteAttrs[2 * index].value.u32;
+                remote_port = remoteAttrs[2 * index + 1].value.u32;
+            }
+            else
+            {
+                // Query the attributes separately to tell which one failed
+                sai_attribute_t attr;
+                attr.id = SAI_PORT_ATTR_FABRIC_ATTACHED_SWITCH_ID;
+                sai_status_t status = sai_port_api->get_port_attribute(ports[i], 1, &attr);
+                if (status != SAI_STATUS_SUCCESS)
                 {
-                    throw runtime_error("FabricPortsOrch get remote id failure");
+                    task_process_status handle_status = handleSaiGetStatus(SAI_API_PORT, status);
+                    if (handle_status != task_process_status::task_success)
+                    {
+                        throw runtime_error("FabricPortsOrch get remote id failure");
+                    }
                 }
-            }
-            remote_peer = attr.value.u32;
+                remote_peer = attr.value.u32;
 
-            attr.id = SAI_PORT_ATTR_FABRIC_ATTACHED_PORT_INDEX;
-            status = sai_port_api->get_port_attribute(port, 1, &attr);
-            if (status != SAI_STATUS_SUCCESS)
-            {
-                task_process_status handle_status = handleSaiGetStatus(SAI_API_PORT, status);
-                if (handle_status != task_process_status::task_success)
+                attr.id = SAI_PORT_ATTR_FABRIC_ATTACHED_PORT_INDEX;
+                status = sai_port_api->get_port_attribute(ports[i], 1, &attr);
+                if (status != SAI_STATUS_SUCCESS)
                 {
-                    throw runtime_error("FabricPortsOrch get remote port index failure");
+                    task_process_status handle_status = handleSaiGetStatus(SAI_API_PORT, status);
+                    if (handle_status != task_process_status::task_success)
+                    {
+                        throw runtime_error("FabricPortsOrch get remote port index failure");
+                    }
                 }
+                remote_port = attr.value.u32;
             }
-            remote_port = attr.value.u32;
         }
 
         values.emplace_back("STATUS", m_portStatus[lane] ? "up" : "down");
@@ -407,7 +513,7 @@ void FabricPortsOrch::updateFabricPortState()
             values.emplace_back("PORT_DOWN_SEEN_LAST_TIME",
                                 to_string(m_portDownSeenLastTime[lane]));
         }
-        m_stateTable->set(key, values);
+        setPortState(key, values);
     }
 }
 
@@ -608,7 +714,7 @@ void FabricPortsOrch::updateFabricDebugCounters()
         // Get the consecutive polls from the state db
         std::vector<FieldValueTuple> values;
         string valuePt;
-        exist = m_stateTable->get(key, values);
+        exist = getPortState(key, values);
         if (!exist)
         {
             SWSS_LOG_INFO("No state infor for port %s", key.c_str());
@@ -920,17 +1026,17 @@ void FabricPortsOrch::updateFabricDebugCounters()
 
         // Update state_db with error rate
         valuePt = to_string(rxCells);
-        m_stateTable->hset(key, "RX_CELLS", valuePt.c_str());
+        setPortStateField(key, "RX_CELLS", valuePt);
         SWSS_LOG_INFO("port %s set RX_CELLS %s",
                       key.c_str(), valuePt.c_str());
 
         valuePt = to_string(prevCrcErrors);
-        m_stateTable->hset(key, "CRC_ERRORS", valuePt.c_str());
+        setPortStateField(key, "CRC_ERRORS", valuePt);
         SWSS_LOG_INFO("port %s set CRC_ERRORS %s",
                       key.c_str(), valuePt.c_str());
 
         valuePt = to_string(prevCodeErrors);
-        m_stateTable->hset(key, "CODE_ERRORS", valuePt.c_str());
+        setPortStateField(key, "CODE_ERRORS", valuePt);
         SWSS_LOG_INFO("port %s set CODE_ERRORS %s",
                       key.c_str(), valuePt.c_str());
     }
@@ -948,12 +1054,75 @@ void FabricPortsOrch::updateStateDbTable(
 
     // Update the state table
     stateTable->hset(key, field, valueStr.c_str());
+    if (stateTable == m_stateTable)
+    {
+        updatePortStateCache(key, field, valueStr);
+    }
 
     // Log the update
     SWSS_LOG_INFO("%s updates %s to %s %d",
                   key.c_str(), field.c_str(), valueStr.c_str(), value);
 }
 
+/*
+ * The fabric port entries of STATE_DB are read once per monitor cycle, the
+ * debug counters, capacity and rate updates of the cycle then work on the
+ * cached entry. The cache is cleared at the start of each cycle so that the
+ * fields set by other applications, like the TEST fields, are still seen.
+ */
+bool FabricPortsOrch::getPortState(const string& key, vector<FieldValueTuple>& values)
+{
+    auto it = m_portStateCache.find(key);
+    if (it != m_portStateCache.end())
+    {
+        values = it->second;
+        return true;
+    }
+
+    if (!m_stateTable->get(key, values))
+    {
+        return false;
+    }
+
+    m_portStateCache[key] = values;
+    return true;
+}
+
+void FabricPortsOrch::setPortState(const string& key, const vector<FieldValueTuple>& values)
+{
+    m_stateTable->set(key, values);
+    for (const auto& fv : values)
+    {
+        updatePortStateCache(key, fvField(fv), fvValue(fv));
+    }
+}
+
+void FabricPortsOrch::setPortStateField(const string& key, const string& field, const string& value)
+{
+    m_stateTable->hset(key, field, value);
+    updatePortStateCache(key, field, value);
+}
+
+void FabricPortsOrch::updatePortStateCache(const string& key, const string& field, const string& value)
+{
+    // Entries not read in this cycle are left to be read from STATE_DB
+    auto it = m_portStateCache.find(key);
+    if (it == m_portStateCache.end())
+    {
+        return;
+    }
+
+    for (auto& fv : it->second)
+    {
+        if (fvField(fv) == field)
+        {
+            fv.second = value;
+            return;
+        }
+    }
+    it->second.emplace_back(field, value);
+}
+
 // Isolate/Unisolate a fabric link
 void FabricPortsOrch::isolateFabricLink(int lane, bool isolate)
 {
@@ -1064,7 +1233,7 @@ void FabricPortsOrch::updateFabricCapacity()
         string valuePt;
 
         // Get fabric serdes link status from STATE_DB
-        bool exist = m_stateTable->get(key, values);
+        bool exist = getPortState(key, values);
         if (!exist)
         {
             SWSS_LOG_INFO("No state infor for port %s", key.c_str());
@@ -1214,7 +1383,7 @@ void FabricPortsOrch::updateFabricRate()
         // get oldRateAverage, oldData, oldTime(time.time) from state db
         std::vector<FieldValueTuple> values;
         string valuePt;
-        bool exist = m_stateTable->get(key, values);
+        bool exist = getPortState(key, values);
         double oldRxRate = 0;
         uint64_t oldRxData = 0;
         double oldTxRate = 0;
@@ -1342,19 +1511,19 @@ void FabricPortsOrch::updateFabricRate()
                          (long long)newTxRate, (long long)txBytes, newTime );
 
         valuePt = to_string(newRxRate);
-        m_stateTable->hset(key, "OLD_RX_RATE_AVG", valuePt.c_str());
+        setPortStateField(key, "OLD_RX_RATE_AVG", valuePt);
 
         valuePt = to_string(rxBytes);
-        m_stateTable->hset(key, "OLD_RX_DATA", valuePt.c_str());
+        setPortStateField(key, "OLD_RX_DATA", valuePt);
 
         valuePt = to_string(newTxRate);
-        m_stateTable->hset(key, "OLD_TX_RATE_AVG", valuePt.c_str());
+        setPortStateField(key, "OLD_TX_RATE_AVG", valuePt);
 
         valuePt = to_string(txBytes);
-        m_stateTable->hset(key, "OLD_TX_DATA", valuePt.c_str());
+        setPortStateField(key, "OLD_TX_DATA", valuePt);
 
         valuePt = to_string(newTime);
-        m_stateTable->hset(key, "LAST_TIME", valuePt.c_str());
+        setPortStateField(key, "LAST_TIME", valuePt);
     }
 }
 
@@ -1525,6 +1694,25 @@ void FabricPortsOrch::doTask(Consumer &consumer)
     {
         doFabricPortTask(consumer);
     }
+
+    m_statePipeline->flush();
+}
+
+void FabricPortsOrch::updatePollStats(const string& name, FabricPollStats& stats, uint64_t cycleUs)
+{
+    stats.cycles++;
+    stats.lastCycleUs = cycleUs;
+    stats.maxCycleUs = max(stats.maxCycleUs, cycleUs);
+
+    SWSS_LOG_INFO("Fabric %s poll of %zu ports took %" PRIu64 " us",
+                  name.c_str(), m_fabricLanePortMap.size(), cycleUs);
+
+    vector<FieldValueTuple> values;
+    values.emplace_back("cycles", to_string(stats.cycles));
+    values.emplace_back("ports", to_string(m_fabricLanePortMap.size()));
+    values.emplace_back("last_cycle_ms", to_string(stats.lastCycleUs / 1000));
+    values.emplace_back("max_cycle_ms", to_string(stats.maxCycleUs / 1000));
+    m_fabricMonitorStatsTable->set(name, values);
 }
 
 void FabricPortsOrch::doTask(swss::SelectableTimer &timer)
@@ -1540,7 +1728,10 @@ void FabricPortsOrch::doTask(swss::SelectableTimer &timer)
 
         if (m_getFabricPortListDone)
         {
+            auto start = chrono::steady_clock::now();
             updateFabricPortState();
+            auto elapsed = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+            updatePollStats("PORT_STATE", m_portStatePollStats, elapsed.count());
         }
         if (((gMySwitchType == "voq") || (gMySwitchType == "fabric")) && (!m_isSwitchStatsGenerated))
         {
@@ -1575,11 +1766,17 @@ void FabricPortsOrch::doTask(swss::SelectableTimer &timer)
         if (m_getFabricPortListDone)
         {
             SWSS_LOG_INFO("Fabric monitor enabled");
+            auto start = chrono::steady_clock::now();
+            m_portStateCache.clear();
             updateFabricDebugCounters();
             updateFabricCapacity();
             updateFabricRate();
+            auto elapsed = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+            updatePollStats("MONITOR", m_monitorPollStats, elapsed.count());
         }
     }
+
+    m_statePipeline->flush();
 }
 
 void FabricPortsOrch::createSwitchDropCounters(void)
@@ -4,6 +4,7 @@
 #include <map>
 
 #include "orch.h"
+#include "redispipeline.h"
 #include "observer.h"
 #include "observer.h"
 #include "producertable.h"
@@ -11,6 +12,15 @@
 
 #define STATE_FABRIC_CAPACITY_TABLE_NAME "FABRIC_CAPACITY_TABLE"
 #define STATE_PORT_CAPACITY_TABLE_NAME "PORT_CAPACITY_TABLE"
+#define STATE_FABRIC_MONITOR_STATS_TABLE_NAME "FABRIC_MONITOR_STATS_TABLE"
+
+/* Duration of the fabric monitor polling cycles */
+struct FabricPollStats
+{
+    uint64_t cycles = 0;
+    uint64_t lastCycleUs = 0;
+    uint64_t maxCycleUs = 0;
+};
 
 class FabricPortsOrch : public Orch, public Subject
 {
@@ -25,6 +35,7 @@ private:
     bool m_fabricQueueStatEnabled;
 
     shared_ptr<DBConnector> m_state_db;
+    unique_ptr<RedisPipeline> m_statePipeline;
     shared_ptr<DBConnector> m_counter_db;
     shared_ptr<DBConnector> m_appl_db;
 
@@ -34,6 +45,7 @@ private:
     unique_ptr<Table> m_fabricCounterTable;
     unique_ptr<Table> m_applTable;
     unique_ptr<Table> m_fabricCapacityTable;
+    unique_ptr<Table> m_fabricMonitorStatsTable;
     unique_ptr<Table> m_applMonitorConstTable;
     unique_ptr<ProducerTable> m_flexCounterTable;
     shared_ptr<Table> m_counterNameToSwitchStatMap;
@@ -51,6 +63,12 @@ private:
     unordered_map<int, size_t> m_portDownCount;
     unordered_map<int, time_t> m_portDownSeenLastTime;
 
+    // Fabric port entries of STATE_DB read in the current monitor cycle, kept up to date with our writes
+    unordered_map<string, vector<FieldValueTuple>> m_portStateCache;
+    bool m_bulkPortGetSupported = true;
+    FabricPollStats m_portStatePollStats;
+    FabricPollStats m_monitorPollStats;
+
     bool m_getFabricPortListDone = false;
     bool m_isQueueStatsGenerated = false;
     bool m_debugTimerEnabled = false;
@@ -79,6 +97,13 @@ private:
         const string& field,
         int value);
     void isolateFabricLink(int lane, bool isolate);
+    bool getPortState(const string& key, vector<FieldValueTuple>& values);
+    void setPortState(const string& key, const vector<FieldValueTuple>& values);
+    void setPortStateField(const string& key, const string& field, const string& value);
+    void updatePortStateCache(const string& key, const string& field, const string& value);
+    void getPortsAttributes(const vector<sai_object_id_t>& ports, const vector<sai_attr_id_t>& attrIds,
+                            vector<sai_attribute_t>& attrs, vector<sai_status_t>& statuses);
+    void updatePollStats(const string& name, FabricPollStats& stats, uint64_t cycleUs);
 
     void doTask() override;
     void doTask(Consumer &consumer);
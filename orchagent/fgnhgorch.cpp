@@ -20,14 +20,17 @@ extern sai_route_api_t*             sai_route_api;
 extern RouteOrch *gRouteOrch;
 extern CrmOrch *gCrmOrch;
 extern PortsOrch *gPortsOrch;
+extern size_t gMaxBulkSize;
 
 FgNhgOrch::FgNhgOrch(DBConnector *db, DBConnector *appDb, DBConnector *stateDb, vector<table_name_with_pri_t> &tableNames, NeighOrch *neighOrch, IntfsOrch *intfsOrch, VRFOrch *vrfOrch) :
         Orch(db, tableNames),
         m_neighOrch(neighOrch),
         m_intfsOrch(intfsOrch),
         m_vrfOrch(vrfOrch),
+        m_stateDb(stateDb),
         m_stateWarmRestartRouteTable(stateDb, STATE_FG_ROUTE_TABLE_NAME),
-        m_routeTable(appDb, APP_ROUTE_TABLE_NAME)
+        m_routeTable(appDb, APP_ROUTE_TABLE_NAME),
+        m_nhgMemberBulker(sai_next_hop_group_api, gSwitchId, gMaxBulkSize)
 {
     SWSS_LOG_ENTER();
     isFineGrainedConfigured = false;
@@ -196,60 +199,83 @@ void FgNhgOrch::calculateBankHashBucketStartIndices(FgNhgEntry *fgNhgEntry)
 }
 
 
-void FgNhgOrch::setStateDbRouteEntry(const IpPrefix &ipPrefix, uint32_t index, NextHopKey nextHop)
+/* Write the next hops of the hash buckets of the route, one field per bucket */
+void FgNhgOrch::setStateDbRouteEntries(const IpPrefix &ipPrefix, const std::vector<FieldValueTuple> &buckets)
 {
     SWSS_LOG_ENTER();
 
-    string key = ipPrefix.to_string();
-    // Write to StateDb
-    std::vector<FieldValueTuple> fvs;
-
-    // check if profile already exists - if yes - skip creation
-    m_stateWarmRestartRouteTable.get(key, fvs);
-
-    //bucket rewrite
-    if (fvs.size() > index)
-    {
-        FieldValueTuple fv(std::to_string(index), nextHop.to_string());
-        fvs[index] = fv;
-        SWSS_LOG_INFO("Set state db entry for ip prefix %s next hop %s with index %d",
-                        ipPrefix.to_string().c_str(), nextHop.to_string().c_str(), index);
-        m_stateWarmRestartRouteTable.set(key, fvs);
-    }
-    else
+    if (buckets.empty())
     {
-        fvs.push_back(FieldValueTuple(std::to_string(index), nextHop.to_string()));
-        SWSS_LOG_INFO("Add new next hop entry %s with index %d for ip prefix %s",
-                nextHop.to_string().c_str(), index, ipPrefix.to_string().c_str());
-        m_stateWarmRestartRouteTable.set(key, fvs);
+        return;
     }
 
+    SWSS_LOG_INFO("Set state db entry for ip prefix %s with %zu hash buckets",
+                    ipPrefix.to_string().c_str(), buckets.size());
+    m_stateWriter.set(m_stateDb, STATE_FG_ROUTE_TABLE_NAME, ipPrefix.to_string(), buckets);
 }
 
+/*
+ * writeHashBucketChange: Queue the rewrite of a hash bucket of the route. The
+ * rewrites are applied by flushHashBucketChanges once all the changes of the
+ * route are computed, a bucket rewritten several times is set once.
+ */
 bool FgNhgOrch::writeHashBucketChange(FGNextHopGroupEntry *syncd_fg_route_entry, uint32_t index, sai_object_id_t nh_oid,
         const IpPrefix &ipPrefix, NextHopKey nextHop)
 {
     SWSS_LOG_ENTER();
 
-    sai_attribute_t nhgm_attr;
-    nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
-    nhgm_attr.value.oid = nh_oid;
-    sai_status_t status = sai_next_hop_group_api->set_next_hop_group_member_attribute(
-                                                              syncd_fg_route_entry->nhopgroup_members[index],
-                                                              &nhgm_attr);
-    if (status != SAI_STATUS_SUCCESS)
+    SWSS_LOG_INFO("Rewrite hash bucket %d of ip prefix %s to next hop %s",
+            index, ipPrefix.to_string().c_str(), nextHop.to_string().c_str());
+    m_hashBucketChanges[index] = std::make_pair(nh_oid, nextHop);
+    return true;
+}
+
+bool FgNhgOrch::flushHashBucketChanges(FGNextHopGroupEntry *syncd_fg_route_entry, const IpPrefix &ipPrefix)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_hashBucketChanges.empty())
+    {
+        return true;
+    }
+
+    std::vector<sai_status_t> statuses(m_hashBucketChanges.size());
+    size_t idx = 0;
+    for (const auto &change : m_hashBucketChanges)
     {
-        SWSS_LOG_ERROR("Failed to set next hop oid %" PRIx64 " member %" PRIx64 ": %d",
-            syncd_fg_route_entry->nhopgroup_members[index], nh_oid, status);
-        task_process_status handle_status = handleSaiSetStatus(SAI_API_NEXT_HOP_GROUP, status);
-        if (handle_status != task_success)
+        sai_attribute_t nhgm_attr;
+        nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+        nhgm_attr.value.oid = change.second.first;
+        m_nhgMemberBulker.set_entry_attribute(&statuses[idx++],
+                syncd_fg_route_entry->nhopgroup_members[change.first], &nhgm_attr);
+    }
+    m_nhgMemberBulker.flush();
+
+    bool success = true;
+    std::vector<FieldValueTuple> buckets;
+    idx = 0;
+    for (const auto &change : m_hashBucketChanges)
+    {
+        sai_status_t status = statuses[idx++];
+        if (status != SAI_STATUS_SUCCESS)
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            SWSS_LOG_ERROR("Failed to set next hop oid %" PRIx64 " member %" PRIx64 ": %d",
+                change.second.first, syncd_fg_route_entry->nhopgroup_members[change.first], status);
+            /* As for the single sets, a failed rewrite of a member is handled as a SAI failure */
+            task_process_status handle_status = handleSaiSetStatus(SAI_API_NEXT_HOP_GROUP, status);
+            if (handle_status != task_success)
+            {
+                success = parseHandleSaiStatusFailure(handle_status) && success;
+                continue;
+            }
         }
+
+        buckets.emplace_back(std::to_string(change.first), change.second.second.to_string());
     }
 
-    setStateDbRouteEntry(ipPrefix, index, nextHop);
-    return true;
+    m_hashBucketChanges.clear();
+    setStateDbRouteEntries(ipPrefix, buckets);
+    return success;
 }
 
 
@@ -856,7 +882,9 @@ bool FgNhgOrch::setInactiveBankToNextAvailableActiveBank(FGNextHopGroupEntry *sy
             syncd_fg_route_entry->next_hop_group_id = rif_next_hop_id;
 
             // remove state_db entry
-            m_stateWarmRestartRouteTable.del(ipPrefix.to_string());
+            m_stateWriter.del(m_stateDb, STATE_FG_ROUTE_TABLE_NAME, ipPrefix.to_string());
+            // The members of the pending bucket rewrites are removed with the group
+            m_hashBucketChanges.clear();
             // Clear data structures
             syncd_fg_route_entry->syncd_fgnhg_map.clear();
             syncd_fg_route_entry->active_nexthops.clear();
@@ -962,7 +990,8 @@ bool FgNhgOrch::computeAndSetHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
 {
     SWSS_LOG_ENTER();
 
-    for (uint32_t bank_idx = 0; bank_idx < bank_member_changes.size(); bank_idx++)
+    bool success = true;
+    for (uint32_t bank_idx = 0; bank_idx < bank_member_changes.size() && success; bank_idx++)
     {
         if (bank_member_changes[bank_idx].active_nhs.size() != 0 ||
                 (bank_member_changes[bank_idx].nhs_to_add.size() != 0 &&
@@ -973,23 +1002,23 @@ bool FgNhgOrch::computeAndSetHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
              * simultaneously, nhs were added(nhs_to_add > 0). 
              * Route this to fn which deals with active banks
              */
-            if (!setActiveBankHashBucketChanges(syncd_fg_route_entry, fgNhgEntry, 
-                        bank_idx, bank_idx, bank_member_changes, nhopgroup_members_set, ipPrefix))
-            {
-                return false;
-            }
+            success = setActiveBankHashBucketChanges(syncd_fg_route_entry, fgNhgEntry, 
+                        bank_idx, bank_idx, bank_member_changes, nhopgroup_members_set, ipPrefix);
         }
         else
         {
-            if (!setInactiveBankHashBucketChanges(syncd_fg_route_entry, fgNhgEntry, 
-                        bank_idx, bank_member_changes, nhopgroup_members_set, ipPrefix))
-            {
-                return false;
-            }
+            success = setInactiveBankHashBucketChanges(syncd_fg_route_entry, fgNhgEntry, 
+                        bank_idx, bank_member_changes, nhopgroup_members_set, ipPrefix);
         }
     }
 
-    return true;
+    /* Apply the bucket rewrites computed so far, all banks at once */
+    if (!flushHashBucketChanges(syncd_fg_route_entry, ipPrefix))
+    {
+        return false;
+    }
+
+    return success;
 }
 
 
@@ -1001,6 +1030,7 @@ bool FgNhgOrch::setNewNhgMembers(FGNextHopGroupEntry &syncd_fg_route_entry, FgNh
 
     sai_status_t status;
     bool isWarmReboot = false;
+    std::vector<FieldValueTuple> buckets;
     auto nexthopsMap = m_recoveryMap.find(ipPrefix.to_string());
     for (uint32_t i = 0; i < fgNhgEntry->hash_bucket_indices.size(); i++) 
     {
@@ -1031,6 +1061,7 @@ bool FgNhgOrch::setNewNhgMembers(FGNextHopGroupEntry &syncd_fg_route_entry, FgNh
         {
             /* Case where all banks are empty, we let retry logic(upon rv false) take care of this scenario */
             SWSS_LOG_INFO("Found no next-hops to add, skipping");
+            setStateDbRouteEntries(ipPrefix, buckets);
             return false;
         }
 
@@ -1096,11 +1127,12 @@ bool FgNhgOrch::setNewNhgMembers(FGNextHopGroupEntry &syncd_fg_route_entry, FgNh
                 task_process_status handle_status = handleSaiCreateStatus(SAI_API_NEXT_HOP_GROUP, status);
                 if (handle_status != task_success)
                 {
+                    setStateDbRouteEntries(ipPrefix, buckets);
                     return parseHandleSaiStatusFailure(handle_status);
                 }
             }
 
-            setStateDbRouteEntry(ipPrefix, j, bank_nh_memb);
+            buckets.emplace_back(std::to_string(j), bank_nh_memb.to_string());
             syncd_fg_route_entry.syncd_fgnhg_map[i][bank_nh_memb].push_back(j);
             syncd_fg_route_entry.active_nexthops.insert(bank_nh_memb);
             syncd_fg_route_entry.nhopgroup_members.push_back(next_hop_group_member_id);
@@ -1108,6 +1140,8 @@ bool FgNhgOrch::setNewNhgMembers(FGNextHopGroupEntry &syncd_fg_route_entry, FgNh
         }
     }
 
+    setStateDbRouteEntries(ipPrefix, buckets);
+
     if (isWarmReboot)
     {
         m_recoveryMap.erase(nexthopsMap);
@@ -1448,7 +1482,7 @@ bool FgNhgOrch::removeFgNhg(sai_object_id_t vrf_id, const IpPrefix &ipPrefix)
         }
 
         // remove state_db entry
-        m_stateWarmRestartRouteTable.del(ipPrefix.to_string());
+        m_stateWriter.del(m_stateDb, STATE_FG_ROUTE_TABLE_NAME, ipPrefix.to_string());
     }
 
     it_route_table->second.erase(it_route);
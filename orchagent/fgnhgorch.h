@@ -6,6 +6,7 @@
 #include "intfsorch.h"
 #include "neighorch.h"
 #include "producerstatetable.h"
+#include "bulker.h"
 
 #include "ipaddress.h"
 #include "ipaddresses.h"
@@ -21,6 +22,8 @@ typedef std::vector<uint32_t> HashBuckets;
 typedef std::map<NextHopKey, HashBuckets> FGNextHopGroupMap;
 typedef std::vector<FGNextHopGroupMap> BankFGNextHopGroupMap;
 typedef std::map<Bank,Bank> InactiveBankMapsToBank;
+/* HashBucketChanges: hash bucket index, (next hop oid, next hop) */
+typedef std::map<uint32_t, std::pair<sai_object_id_t, NextHopKey>> HashBucketChanges;
 
 struct FGNextHopGroupEntry
 {
@@ -122,9 +125,14 @@ private:
     FgNhgPrefixes m_fgNhgPrefixes;
     bool isFineGrainedConfigured;
 
+    DBConnector *m_stateDb;
     Table m_stateWarmRestartRouteTable;
     ProducerStateTable m_routeTable;
 
+    // Hash bucket rewrites of the route being updated, applied in bulk
+    ObjectBulker<sai_next_hop_group_api_t> m_nhgMemberBulker;
+    HashBucketChanges m_hashBucketChanges;
+
     FgPrefixOpCache m_fgPrefixAddCache;
     FgPrefixOpCache m_fgPrefixDelCache;
 
@@ -148,9 +156,10 @@ private:
                     uint32_t bank, std::vector<BankMemberChanges> bank_member_changes,
                     std::map<NextHopKey,sai_object_id_t> &nhopgroup_members_set, const IpPrefix&);
     void calculateBankHashBucketStartIndices(FgNhgEntry *fgNhgEntry);
-    void setStateDbRouteEntry(const IpPrefix&, uint32_t index, NextHopKey nextHop);
+    void setStateDbRouteEntries(const IpPrefix&, const std::vector<FieldValueTuple> &buckets);
     bool writeHashBucketChange(FGNextHopGroupEntry *syncd_fg_route_entry, uint32_t index, sai_object_id_t nh_oid,
                     const IpPrefix &ipPrefix, NextHopKey nextHop);
+    bool flushHashBucketChanges(FGNextHopGroupEntry *syncd_fg_route_entry, const IpPrefix &ipPrefix);
     bool modifyRoutesNextHopId(sai_object_id_t vrf_id, const IpPrefix &ipPrefix, sai_object_id_t next_hop_id);
     bool createFineGrainedNextHopGroup(FGNextHopGroupEntry &syncd_fg_route_entry, FgNhgEntry *fgNhgEntry,
                     const NextHopGroupKey &nextHops);
@@ -0,0 +1,319 @@
+#include "counter_rate_engine.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+
+#include "schema.h"
+
+using namespace std;
+
+const CounterRateSpec gPortRateSpec =
+{
+    "PORT",
+    COUNTERS_PORT_NAME_MAP,
+    {
+        "SAI_PORT_STAT_IF_IN_UCAST_PKTS",
+        "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS",
+        "SAI_PORT_STAT_IF_OUT_UCAST_PKTS",
+        "SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS",
+        "SAI_PORT_STAT_IF_IN_OCTETS",
+        "SAI_PORT_STAT_IF_OUT_OCTETS"
+    },
+    {
+        { "RX_BPS", { 4 } },
+        { "RX_PPS", { 0, 1 } },
+        { "TX_BPS", { 5 } },
+        { "TX_PPS", { 2, 3 } }
+    },
+    false,
+    false
+};
+
+const CounterRateSpec gRifRateSpec =
+{
+    "RIF",
+    COUNTERS_RIF_NAME_MAP,
+    {
+        "SAI_ROUTER_INTERFACE_STAT_IN_OCTETS",
+        "SAI_ROUTER_INTERFACE_STAT_IN_PACKETS",
+        "SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS",
+        "SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS"
+    },
+    {
+        { "RX_BPS", { 0 } },
+        { "RX_PPS", { 1 } },
+        { "TX_BPS", { 2 } },
+        { "TX_PPS", { 3 } }
+    },
+    false,
+    false
+};
+
+const CounterRateSpec gTunnelRateSpec =
+{
+    "TUNNEL",
+    COUNTERS_TUNNEL_NAME_MAP,
+    {
+        "SAI_TUNNEL_STAT_IN_OCTETS",
+        "SAI_TUNNEL_STAT_IN_PACKETS",
+        "SAI_TUNNEL_STAT_OUT_OCTETS",
+        "SAI_TUNNEL_STAT_OUT_PACKETS"
+    },
+    {
+        { "RX_BPS", { 0 } },
+        { "RX_PPS", { 1 } },
+        { "TX_BPS", { 2 } },
+        { "TX_PPS", { 3 } }
+    },
+    true,
+    true
+};
+
+const CounterRateSpec gTrapRateSpec =
+{
+    "TRAP",
+    COUNTERS_TRAP_NAME_MAP,
+    {
+        "SAI_COUNTER_STAT_PACKETS"
+    },
+    {
+        { "RX_PPS", { 0 } }
+    },
+    false,
+    false
+};
+
+CounterRateEngine::CounterRateEngine(const CounterRateSpec &spec) :
+    m_spec(spec),
+    m_counterCount(spec.counters.size()),
+    m_rateCount(spec.rates.size())
+{
+}
+
+string CounterRateEngine::stateToString(CounterRateState state)
+{
+    switch (state)
+    {
+        case CounterRateState::COUNTERS_LAST:
+            return "COUNTERS_LAST";
+        case CounterRateState::DONE:
+            return "DONE";
+        default:
+            return "";
+    }
+}
+
+CounterRateState CounterRateEngine::stateFromString(const string &state)
+{
+    if (state == "DONE")
+    {
+        return CounterRateState::DONE;
+    }
+    if (state == "COUNTERS_LAST")
+    {
+        return CounterRateState::COUNTERS_LAST;
+    }
+    return CounterRateState::NONE;
+}
+
+string CounterRateEngine::formatRate(double rate)
+{
+    // Redis converts the Lua numbers passed to HSET with %.17g
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.17g", rate);
+    return buf;
+}
+
+size_t CounterRateEngine::getSlot(const string &oid)
+{
+    auto it = m_slots.find(oid);
+    if (it != m_slots.end())
+    {
+        return it->second;
+    }
+
+    size_t slot = m_oids.size();
+    m_slots.emplace(oid, slot);
+    m_oids.push_back(oid);
+    m_states.push_back(CounterRateState::NONE);
+    m_last.resize(m_last.size() + m_counterCount, 0);
+    m_rates.resize(m_rates.size() + m_rateCount, 0);
+
+    return slot;
+}
+
+void CounterRateEngine::restore(const string &oid, const string &initDone,
+                                const vector<uint64_t> &last, const vector<double> &rates)
+{
+    size_t slot = getSlot(oid);
+    CounterRateState state = stateFromString(initDone);
+
+    // Fall back to an earlier state if the saved values are incomplete
+    if (state == CounterRateState::DONE && rates.size() != m_rateCount)
+    {
+        state = CounterRateState::COUNTERS_LAST;
+    }
+    if (state != CounterRateState::NONE && last.size() != m_counterCount)
+    {
+        state = CounterRateState::NONE;
+    }
+
+    m_states[slot] = state;
+    if (state != CounterRateState::NONE)
+    {
+        copy(last.begin(), last.end(), m_last.begin() + slot * m_counterCount);
+    }
+    if (state == CounterRateState::DONE)
+    {
+        copy(rates.begin(), rates.end(), m_rates.begin() + slot * m_rateCount);
+    }
+}
+
+void CounterRateEngine::remove(const string &oid)
+{
+    auto it = m_slots.find(oid);
+    if (it == m_slots.end())
+    {
+        return;
+    }
+
+    // Move the last slot in place of the removed one
+    size_t slot = it->second;
+    size_t back = m_oids.size() - 1;
+    m_slots.erase(it);
+
+    if (slot != back)
+    {
+        m_oids[slot] = m_oids[back];
+        m_slots[m_oids[slot]] = slot;
+        m_states[slot] = m_states[back];
+        copy_n(m_last.begin() + back * m_counterCount, m_counterCount, m_last.begin() + slot * m_counterCount);
+        copy_n(m_rates.begin() + back * m_rateCount, m_rateCount, m_rates.begin() + slot * m_rateCount);
+    }
+
+    m_oids.pop_back();
+    m_states.pop_back();
+    m_last.resize(back * m_counterCount);
+    m_rates.resize(back * m_rateCount);
+}
+
+void CounterRateEngine::update(const vector<string> &oids, const vector<uint64_t> &counters,
+                               const vector<uint8_t> &present, double alpha, double deltaMs,
+                               vector<CounterRateUpdate> &updates)
+{
+    updates.clear();
+
+    // Objects updated in this poll, by their row in counters and their slot
+    vector<size_t> rows;
+    vector<size_t> slots;
+    rows.reserve(oids.size());
+    slots.reserve(oids.size());
+
+    for (size_t i = 0; i < oids.size(); i++)
+    {
+        bool complete = all_of(present.begin() + i * m_counterCount,
+                               present.begin() + (i + 1) * m_counterCount,
+                               [](uint8_t p) { return p != 0; });
+        if (!complete && !m_spec.missingCountersAsZero)
+        {
+            continue;
+        }
+
+        rows.push_back(i);
+        slots.push_back(getSlot(oids[i]));
+    }
+
+    size_t count = rows.size();
+    const double oneMinusAlpha = 1.0 - alpha;
+
+    vector<double> current(count);
+    vector<double> last(count);
+    vector<double> previous(count);
+    vector<uint8_t> smooth(count);
+    vector<double> rates(count * m_rateCount);
+
+    for (size_t k = 0; k < count; k++)
+    {
+        smooth[k] = m_states[slots[k]] == CounterRateState::DONE;
+    }
+
+    for (size_t r = 0; r < m_rateCount; r++)
+    {
+        const auto &rateCounters = m_spec.rates[r].counters;
+
+        // Sum the counters of the rate as the Lua plugins, in double
+        for (size_t k = 0; k < count; k++)
+        {
+            const uint64_t *newCounters = &counters[rows[k] * m_counterCount];
+            const uint8_t *newPresent = &present[rows[k] * m_counterCount];
+            const uint64_t *lastCounters = &m_last[slots[k] * m_counterCount];
+            double sum = 0;
+            double lastSum = 0;
+            for (auto c : rateCounters)
+            {
+                sum += newPresent[c] ? static_cast<double>(newCounters[c]) : 0;
+                lastSum += static_cast<double>(lastCounters[c]);
+            }
+            current[k] = sum;
+            last[k] = lastSum;
+            previous[k] = m_rates[slots[k] * m_rateCount + r];
+        }
+
+        if (m_spec.scaleBeforeDivide)
+        {
+            for (size_t k = 0; k < count; k++)
+            {
+                double rate = (current[k] - last[k]) * 1000 / deltaMs;
+                double smoothed = alpha * rate + oneMinusAlpha * previous[k];
+                rates[k * m_rateCount + r] = smooth[k] ? smoothed : rate;
+            }
+        }
+        else
+        {
+            for (size_t k = 0; k < count; k++)
+            {
+                double rate = (current[k] - last[k]) / deltaMs * 1000;
+                double smoothed = alpha * rate + oneMinusAlpha * previous[k];
+                rates[k * m_rateCount + r] = smooth[k] ? smoothed : rate;
+            }
+        }
+    }
+
+    updates.resize(count);
+    for (size_t k = 0; k < count; k++)
+    {
+        size_t slot = slots[k];
+        auto &update = updates[k];
+        update.oid = oids[rows[k]];
+        update.stateChanged = false;
+
+        CounterRateState state = m_states[slot];
+        if (state == CounterRateState::NONE)
+        {
+            state = CounterRateState::COUNTERS_LAST;
+            update.stateChanged = true;
+        }
+        else
+        {
+            if (state == CounterRateState::COUNTERS_LAST)
+            {
+                state = CounterRateState::DONE;
+                update.stateChanged = true;
+            }
+            update.rates.assign(rates.begin() + k * m_rateCount, rates.begin() + (k + 1) * m_rateCount);
+            copy(update.rates.begin(), update.rates.end(), m_rates.begin() + slot * m_rateCount);
+        }
+        m_states[slot] = state;
+        update.state = state;
+
+        const uint64_t *newCounters = &counters[rows[k] * m_counterCount];
+        const uint8_t *newPresent = &present[rows[k] * m_counterCount];
+        update.last.resize(m_counterCount);
+        for (size_t c = 0; c < m_counterCount; c++)
+        {
+            update.last[c] = newPresent[c] ? newCounters[c] : 0;
+        }
+        copy(update.last.begin(), update.last.end(), m_last.begin() + slot * m_counterCount);
+    }
+}
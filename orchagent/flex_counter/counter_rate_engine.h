@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define RATES_TABLE_NAME "RATES"
+#define RATES_INIT_DONE_FIELD "INIT_DONE"
+
+/*
+ * A rate computed from the sum of some counters of an object, for example
+ * RX_PPS of a port from its unicast and non unicast received packets.
+ */
+struct CounterRate
+{
+    std::string name;
+    std::vector<size_t> counters;   // Indexes in CounterRateSpec::counters
+};
+
+/*
+ * The rates of a type of objects, with the same RATES table schema as the
+ * <type>_rates.lua flex counter plugins:
+ *   RATES:<type>            <type>_ALPHA, the smoothing factor
+ *   RATES:<oid>             the rates and the <counter>_last values
+ *   RATES:<oid>:<type>      INIT_DONE, COUNTERS_LAST or DONE
+ */
+struct CounterRateSpec
+{
+    std::string type;
+    std::string nameMap;                // COUNTERS_DB map of the objects
+    std::vector<std::string> counters;
+    std::vector<CounterRate> rates;
+    bool missingCountersAsZero;         // Else objects missing a counter are skipped
+    bool scaleBeforeDivide;             // Rate is diff * 1000 / delta instead of diff / delta * 1000
+};
+
+extern const CounterRateSpec gPortRateSpec;
+extern const CounterRateSpec gRifRateSpec;
+extern const CounterRateSpec gTunnelRateSpec;
+extern const CounterRateSpec gTrapRateSpec;
+
+enum class CounterRateState : uint8_t
+{
+    NONE,
+    COUNTERS_LAST,
+    DONE
+};
+
+struct CounterRateUpdate
+{
+    std::string oid;
+    CounterRateState state;
+    bool stateChanged;
+    std::vector<double> rates;      // Empty if the rates are not computed yet
+    std::vector<uint64_t> last;
+};
+
+/*
+ * Exponentially smoothed rates of the counters of a set of objects. The
+ * state of the objects is kept in flat arrays, indexed by the slot of the
+ * object, so that the rates of all the objects are computed in tight loops.
+ */
+class CounterRateEngine
+{
+public:
+    explicit CounterRateEngine(const CounterRateSpec &spec);
+
+    const CounterRateSpec &getSpec() const { return m_spec; }
+    size_t size() const { return m_oids.size(); }
+    bool contains(const std::string &oid) const { return m_slots.find(oid) != m_slots.end(); }
+    const std::vector<std::string> &getObjects() const { return m_oids; }
+
+    /* Restore the state of an object saved in the RATES table */
+    void restore(const std::string &oid, const std::string &initDone,
+                 const std::vector<uint64_t> &last, const std::vector<double> &rates);
+    void remove(const std::string &oid);
+
+    /*
+     * Update the rates of the objects from their new counters, the counters
+     * of oids[i] are counters[i * counter count + c] with present[...] false
+     * for the counters missing from COUNTERS_DB. deltaMs is the interval
+     * between two polls of the counters.
+     */
+    void update(const std::vector<std::string> &oids, const std::vector<uint64_t> &counters,
+                const std::vector<uint8_t> &present, double alpha, double deltaMs,
+                std::vector<CounterRateUpdate> &updates);
+
+    static std::string stateToString(CounterRateState state);
+    static CounterRateState stateFromString(const std::string &state);
+    /* Format a rate as Redis formats the Lua numbers */
+    static std::string formatRate(double rate);
+
+private:
+    size_t getSlot(const std::string &oid);
+
+    const CounterRateSpec m_spec;
+    const size_t m_counterCount;
+    const size_t m_rateCount;
+
+    std::unordered_map<std::string, size_t> m_slots;
+    std::vector<std::string> m_oids;
+    std::vector<CounterRateState> m_states;
+    std::vector<uint64_t> m_last;       // m_last[slot * m_counterCount + counter]
+    std::vector<double> m_rates;        // m_rates[slot * m_rateCount + rate]
+};
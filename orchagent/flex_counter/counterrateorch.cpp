@@ -0,0 +1,243 @@
+#include "counterrateorch.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "logger.h"
+#include "notifier.h"
+#include "schema.h"
+
+using namespace std;
+using namespace swss;
+
+CounterRateOrch::CounterRateOrch() :
+    m_countersDb(new DBConnector("COUNTERS_DB", 0))
+{
+    SWSS_LOG_ENTER();
+
+    m_pipeline = unique_ptr<RedisPipeline>(new RedisPipeline(m_countersDb.get()));
+    m_countersTable = unique_ptr<Table>(new Table(m_countersDb.get(), COUNTERS_TABLE));
+    m_ratesTable = unique_ptr<Table>(new Table(m_pipeline.get(), RATES_TABLE_NAME, true));
+
+    addGroup(gPortRateSpec);
+    addGroup(gRifRateSpec);
+    addGroup(gTunnelRateSpec);
+    addGroup(gTrapRateSpec);
+
+    m_pollConsumer = new NotificationConsumer(m_countersDb.get(), COUNTER_RATES_POLL_CHANNEL);
+    Orch::addExecutor(new Notifier(m_pollConsumer, this, COUNTER_RATES_POLL_CHANNEL));
+}
+
+void CounterRateOrch::addGroup(const CounterRateSpec &spec)
+{
+    m_groups.emplace_back(new CounterRateEngine(spec));
+}
+
+/* Objects of the group in its COUNTERS name map */
+void CounterRateOrch::getObjects(const CounterRateSpec &spec, vector<string> &oids)
+{
+    vector<FieldValueTuple> nameMap;
+    Table(m_countersDb.get(), spec.nameMap).get("", nameMap);
+
+    oids.clear();
+    for (const auto &fv : nameMap)
+    {
+        oids.push_back(fvValue(fv));
+    }
+    sort(oids.begin(), oids.end());
+    oids.erase(unique(oids.begin(), oids.end()), oids.end());
+}
+
+/* Group of the object polled first by a flex counter group */
+CounterRateEngine *CounterRateOrch::getGroup(const string &oid)
+{
+    for (auto &group : m_groups)
+    {
+        if (group->contains(oid))
+        {
+            return group.get();
+        }
+    }
+
+    // The object is not known yet, e.g. on the first poll of the group
+    vector<string> oids;
+    for (auto &group : m_groups)
+    {
+        getObjects(group->getSpec(), oids);
+        if (binary_search(oids.begin(), oids.end(), oid))
+        {
+            return group.get();
+        }
+    }
+
+    return nullptr;
+}
+
+void CounterRateOrch::doTask(NotificationConsumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    if (&consumer != m_pollConsumer)
+    {
+        return;
+    }
+
+    // The first object polled by the group and the poll interval
+    string oid, interval;
+    vector<FieldValueTuple> values;
+    consumer.pop(oid, interval, values);
+
+    auto group = getGroup(oid);
+    if (group == nullptr)
+    {
+        SWSS_LOG_INFO("No rates for the flex counter group polling %s", oid.c_str());
+        return;
+    }
+
+    double intervalMs = strtod(interval.c_str(), nullptr);
+    if (intervalMs <= 0)
+    {
+        SWSS_LOG_WARN("Invalid poll interval %s of the %s rates", interval.c_str(), group->getSpec().type.c_str());
+        return;
+    }
+
+    updateRates(*group, intervalMs);
+}
+
+/* Restore the rates state of the objects saved in the RATES table, e.g. before a restart */
+void CounterRateOrch::restoreObjects(CounterRateEngine &group, const vector<string> &oids)
+{
+    SWSS_LOG_ENTER();
+
+    const auto &spec = group.getSpec();
+
+    for (const auto &oid : oids)
+    {
+        vector<FieldValueTuple> fvs;
+        m_ratesTable->get(oid, fvs);
+        unordered_map<string, string> fields(fvs.begin(), fvs.end());
+
+        vector<double> rates;
+        for (const auto &rate : spec.rates)
+        {
+            auto it = fields.find(rate.name);
+            if (it == fields.end())
+            {
+                rates.clear();
+                break;
+            }
+            rates.push_back(strtod(it->second.c_str(), nullptr));
+        }
+
+        vector<uint64_t> last;
+        for (const auto &counter : spec.counters)
+        {
+            auto it = fields.find(counter + "_last");
+            if (it == fields.end())
+            {
+                last.clear();
+                break;
+            }
+            last.push_back(strtoull(it->second.c_str(), nullptr, 10));
+        }
+
+        string initDone;
+        m_ratesTable->hget(oid + ":" + spec.type, RATES_INIT_DONE_FIELD, initDone);
+
+        group.restore(oid, initDone, last, rates);
+    }
+}
+
+void CounterRateOrch::updateRates(CounterRateEngine &group, double intervalMs)
+{
+    SWSS_LOG_ENTER();
+
+    const auto &spec = group.getSpec();
+
+    string alphaStr;
+    if (!m_ratesTable->hget(spec.type, spec.type + "_ALPHA", alphaStr))
+    {
+        SWSS_LOG_INFO("%s rates alpha is not defined", spec.type.c_str());
+        return;
+    }
+    double alpha = strtod(alphaStr.c_str(), nullptr);
+
+    vector<string> oids;
+    getObjects(spec, oids);
+
+    // Forget the objects removed from the name map and restore the new ones
+    vector<string> removed;
+    for (const auto &oid : group.getObjects())
+    {
+        if (!binary_search(oids.begin(), oids.end(), oid))
+        {
+            removed.push_back(oid);
+        }
+    }
+    for (const auto &oid : removed)
+    {
+        group.remove(oid);
+    }
+
+    vector<string> added;
+    for (const auto &oid : oids)
+    {
+        if (!group.contains(oid))
+        {
+            added.push_back(oid);
+        }
+    }
+    if (!added.empty())
+    {
+        restoreObjects(group, added);
+    }
+
+    size_t counterCount = spec.counters.size();
+    vector<uint64_t> counters(oids.size() * counterCount, 0);
+    vector<uint8_t> present(oids.size() * counterCount, 0);
+    for (size_t i = 0; i < oids.size(); i++)
+    {
+        vector<FieldValueTuple> fvs;
+        m_countersTable->get(oids[i], fvs);
+        unordered_map<string, string> fields(fvs.begin(), fvs.end());
+
+        for (size_t c = 0; c < counterCount; c++)
+        {
+            auto it = fields.find(spec.counters[c]);
+            if (it != fields.end())
+            {
+                counters[i * counterCount + c] = strtoull(it->second.c_str(), nullptr, 10);
+                present[i * counterCount + c] = 1;
+            }
+        }
+    }
+
+    vector<CounterRateUpdate> updates;
+    group.update(oids, counters, present, alpha, intervalMs, updates);
+
+    for (const auto &update : updates)
+    {
+        vector<FieldValueTuple> fvs;
+        for (size_t r = 0; r < update.rates.size(); r++)
+        {
+            fvs.emplace_back(spec.rates[r].name, CounterRateEngine::formatRate(update.rates[r]));
+        }
+        for (size_t c = 0; c < update.last.size(); c++)
+        {
+            fvs.emplace_back(spec.counters[c] + "_last", to_string(update.last[c]));
+        }
+        m_ratesTable->set(update.oid, fvs);
+
+        if (update.stateChanged)
+        {
+            m_ratesTable->set(update.oid + ":" + spec.type,
+                              { { RATES_INIT_DONE_FIELD, CounterRateEngine::stateToString(update.state) } });
+        }
+    }
+
+    m_pipeline->flush();
+
+    SWSS_LOG_INFO("Updated %s rates of %zu objects", spec.type.c_str(), updates.size());
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dbconnector.h"
+#include "notificationconsumer.h"
+#include "orch.h"
+#include "redispipeline.h"
+#include "table.h"
+#include "counter_rate_engine.h"
+
+/* Plugin run by the rate flex counter groups instead of <type>_rates.lua when the rates are computed by orchagent */
+#define COUNTER_RATES_POLL_PLUGIN   "counter_rates_poll.lua"
+/* Channel of COUNTER_RATES_POLL_PLUGIN */
+#define COUNTER_RATES_POLL_CHANNEL  "COUNTER_RATES_POLL"
+
+/*
+ * Compute the rates of the port, RIF, tunnel and trap counters in orchagent
+ * instead of the rate Lua plugins of the flex counter groups, when orchagent
+ * is started with -R. The groups then run COUNTER_RATES_POLL_PLUGIN, which
+ * only notifies the end of each poll, and the rates are updated from the
+ * counters of that poll over its interval, as the rate plugins do.
+ */
+class CounterRateOrch : public Orch
+{
+public:
+    CounterRateOrch();
+
+    void doTask(swss::NotificationConsumer &consumer) override;
+    void doTask(Consumer &consumer) override {}
+
+private:
+    void addGroup(const CounterRateSpec &spec);
+    CounterRateEngine *getGroup(const std::string &oid);
+    void getObjects(const CounterRateSpec &spec, std::vector<std::string> &oids);
+    void updateRates(CounterRateEngine &group, double intervalMs);
+    void restoreObjects(CounterRateEngine &group, const std::vector<std::string> &oids);
+
+    std::vector<std::unique_ptr<CounterRateEngine>> m_groups;
+
+    std::shared_ptr<swss::DBConnector> m_countersDb;
+    std::unique_ptr<swss::RedisPipeline> m_pipeline;
+    std::unique_ptr<swss::Table> m_countersTable;
+    std::unique_ptr<swss::Table> m_ratesTable;
+    swss::NotificationConsumer *m_pollConsumer = nullptr;
+};
@@ -9,7 +9,9 @@
 #include "table.h"
 #include "vnetorch.h"
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 extern Directory<Orch*>  gDirectory;
 extern RouteOrch*        gRouteOrch;
@@ -637,24 +639,27 @@ void FlowCounterRouteOrch::createRouteFlowCounterByPattern(const RoutePattern &r
     {
         SWSS_LOG_NOTICE("Creating route flow counter for pattern %s", route_pattern.to_string().c_str());
 
-        for (auto &entry : iter->second)
+        // The route table is iterated in hash order, bind the first matching routes in prefix order
+        std::vector<IpPrefix> matched_prefixes;
+        for (const auto &entry : iter->second)
+        {
+            if (route_pattern.is_match(route_pattern.vrf_id, entry.first) && !isRouteAlreadyBound(route_pattern, entry.first))
+            {
+                matched_prefixes.push_back(entry.first);
+            }
+        }
+        std::sort(matched_prefixes.begin(), matched_prefixes.end());
+
+        for (const auto &ip_prefix : matched_prefixes)
         {
             if (current_bound_count == route_pattern.max_match_count)
             {
                 return;
             }
 
-            if (route_pattern.is_match(route_pattern.vrf_id, entry.first))
+            if (bindFlowCounter(route_pattern, route_pattern.vrf_id, ip_prefix))
             {
-                if (isRouteAlreadyBound(route_pattern, entry.first))
-                {
-                    continue;
-                }
-
-                if (bindFlowCounter(route_pattern, route_pattern.vrf_id, entry.first))
-                {
-                    ++current_bound_count;
-                }
+                ++current_bound_count;
             }
         }
     }
@@ -13,6 +13,7 @@
 #include "tokenize.h"
 #include "routeorch.h"
 #include "flowcounterrouteorch.h"
+#include "counterrateorch.h"
 #include "crmorch.h"
 #include "bufferorch.h"
 #include "directory.h"
@@ -38,6 +39,7 @@ extern NeighOrch *gNeighOrch;
 extern string gMySwitchType;
 extern int32_t gVoqMySwitchId;
 extern bool gTraditionalFlexCounter;
+extern bool gCounterRatesInOrch;
 
 const int intfsorch_pri = 35;
 
@@ -79,7 +81,7 @@ IntfsOrch::IntfsOrch(DBConnector *db, string tableName, VRFOrch *vrf_orch, DBCon
     auto executorT = new ExecutableTimer(m_updateMapsTimer, this, "UPDATE_MAPS_TIMER");
     Orch::addExecutor(executorT);
 
-    string rifRatePluginName = "rif_rates.lua";
+    string rifRatePluginName = gCounterRatesInOrch ? COUNTER_RATES_POLL_PLUGIN : "rif_rates.lua";
     string rifRateSha;
 
     try
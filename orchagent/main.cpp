@@ -69,10 +69,11 @@ uint32_t gCfgSystemPorts = 0;
 string gMyHostName = "";
 string gMyAsicName = "";
 bool gTraditionalFlexCounter = false;
+bool gCounterRatesInOrch = false;
 
 void usage()
 {
-    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode]" << endl;
+    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-a zmq_response_address] [-R]" << endl;
     cout << "    -h: display this message" << endl;
     cout << "    -r record_type: record orchagent logs with type (default 3)" << endl;
     cout << "                    Bit 0: sairedis.rec, Bit 1: swss.rec, Bit 2: responsepublisher.rec. For example:" << endl;
@@ -92,6 +93,8 @@ void usage()
     cout << "    -k max bulk size in bulk mode (default 1000)" << endl;
     cout << "    -q zmq_server_address: ZMQ server address (default disable ZMQ)" << endl;
     cout << "    -c counter mode (traditional|asic_db), default: asic_db" << endl;
+    cout << "    -a zmq_response_address: send the P4RT and DASH responses to this ZMQ address (default redis channels)" << endl;
+    cout << "    -R compute the port, RIF, tunnel and trap counter rates in orchagent instead of the flex counter Lua plugins" << endl;
 }
 
 void sighup_handler(int signo)
@@ -343,10 +346,11 @@ int main(int argc, char **argv)
     string sairedis_rec_filename = Recorder::SAIREDIS_FNAME;
     string zmq_server_address = "tcp://127.0.0.1:" + to_string(ORCH_ZMQ_PORT);
     bool   enable_zmq = false;
+    string zmq_response_address;
     string responsepublisher_rec_filename = Recorder::RESPPUB_FNAME;
     int record_type = 3; // Only swss and sairedis recordings enabled by default.
 
-    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:")) != -1)
+    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:a:R")) != -1)
     {
         switch (opt)
         {
@@ -403,6 +407,16 @@ int main(int argc, char **argv)
                 gTraditionalFlexCounter = true;
             }
             break;
+        case 'a':
+            if (optarg)
+            {
+                zmq_response_address = optarg;
+            }
+            break;
+        case 'R':
+            gCounterRatesInOrch = true;
+            SWSS_LOG_NOTICE("Computing the counter rates in orchagent");
+            break;
         case 'f':
 
             if (optarg)
@@ -489,6 +503,14 @@ int main(int argc, char **argv)
         SWSS_LOG_NOTICE("ZMQ disabled");
     }
 
+    // Instantiate ZMQ client of the response channel
+    shared_ptr<ZmqClient> zmq_response_client = nullptr;
+    if (!zmq_response_address.empty())
+    {
+        SWSS_LOG_NOTICE("Instantiate ZMQ response client : %s", zmq_response_address.c_str());
+        zmq_response_client = make_shared<ZmqClient>(zmq_response_address);
+    }
+
     // Get switch_type
     getCfgSwitchType(&config_db, gMySwitchType);
 
@@ -776,6 +798,7 @@ int main(int argc, char **argv)
             orchDaemon->setFabricPortStatEnabled(true);
             orchDaemon->setFabricQueueStatEnabled(false);
         }
+        orchDaemon->setResponseZmqClient(zmq_response_client.get());
     }
     else
     {
@@ -83,6 +83,7 @@ MirrorOrch::MirrorOrch(TableConnector stateDbConnector, TableConnector confDbCon
         m_neighOrch(neighOrch),
         m_fdbOrch(fdbOrch),
         m_policerOrch(policerOrch),
+        m_stateDb(stateDbConnector.first),
         m_mirrorTable(stateDbConnector.first, stateDbConnector.second)
 {
     sai_status_t status;
@@ -631,14 +632,14 @@ void MirrorOrch::setSessionState(const string& name, const MirrorEntry& session,
      fvVector.emplace_back(MIRROR_SESSION_NEXT_HOP_IP, value);
     }
 
-    m_mirrorTable.set(name, fvVector);
+    m_stateWriter.set(m_stateDb, m_mirrorTable.getTableName(), name, fvVector);
 }
 
 void MirrorOrch::removeSessionState(const string& name)
 {
 	SWSS_LOG_ENTER();
 
-	m_mirrorTable.del(name);
+	m_stateWriter.del(m_stateDb, m_mirrorTable.getTableName(), name);
 }
 
 bool MirrorOrch::getNeighborInfo(const string& name, MirrorEntry& session)
@@ -98,6 +98,7 @@ private:
     // Maximum number of traffic classes starting at 0, thus queue can be 0 - m_maxNumTC-1
     uint8_t m_maxNumTC;
 
+    DBConnector *m_stateDb;
     Table m_mirrorTable;
 
     MirrorTable m_syncdMirrors;
@@ -1,49 +1,74 @@
 #ifndef SWSS_NEXTHOPGROUPKEY_H
 #define SWSS_NEXTHOPGROUPKEY_H
 
+#include <functional>
+#include <memory>
+#include <set>
+#include <unordered_map>
+
 #include "nexthopkey.h"
 
+class NextHopGroupKeyInterner;
+
+/*
+ * The next hops of a key are shared between its copies and only copied when
+ * a copy is modified, so that passing keys between the orchs and storing
+ * them per route doesn't duplicate the next hop sets. Keys sharing the same
+ * next hops compare equal without comparing the sets.
+ *
+ * Keys are ordered by a hash of their next hops first, computed once per key
+ * and kept by its copies, so that probing the maps of next hop groups only
+ * compares the sets of the keys with the same hash.
+ */
 class NextHopGroupKey
 {
 public:
-    NextHopGroupKey() = default;
+    NextHopGroupKey() :
+        m_nexthops(emptyNextHops()), m_overlay_nexthops(false), m_srv6_nexthops(false) {}
 
     /* ip_string@if_alias separated by ',' */
     NextHopGroupKey(const std::string &nexthops)
     {
         m_overlay_nexthops = false;
         m_srv6_nexthops = false;
+        auto nhs = std::make_shared<std::set<NextHopKey>>();
         auto nhv = tokenize(nexthops, NHG_DELIMITER);
         for (const auto &nh : nhv)
         {
-            m_nexthops.insert(nh);
+            nhs->insert(nh);
         }
+        m_nexthops = std::move(nhs);
     }
 
     /* ip_string|if_alias|vni|router_mac separated by ',' */
-    NextHopGroupKey(const std::string &nexthops, bool overlay_nh, bool srv6_nh = false)
+    NextHopGroupKey(const std::string &nexthops, bool overlay_nh, bool srv6_nh = false) :
+        m_nexthops(emptyNextHops()), m_overlay_nexthops(false), m_srv6_nexthops(false)
     {
         if (overlay_nh)
         {
             m_overlay_nexthops = true;
             m_srv6_nexthops = false;
+            auto nhs = std::make_shared<std::set<NextHopKey>>();
             auto nhv = tokenize(nexthops, NHG_DELIMITER);
             for (const auto &nh_str : nhv)
             {
                 auto nh = NextHopKey(nh_str, overlay_nh, srv6_nh);
-                m_nexthops.insert(nh);
+                nhs->insert(nh);
             }
+            m_nexthops = std::move(nhs);
         }
         else if (srv6_nh)
         {
             m_overlay_nexthops = false;
             m_srv6_nexthops = true;
+            auto nhs = std::make_shared<std::set<NextHopKey>>();
             auto nhv = tokenize(nexthops, NHG_DELIMITER);
             for (const auto &nh_str : nhv)
             {
                 auto nh = NextHopKey(nh_str, overlay_nh, srv6_nh);
-                m_nexthops.insert(nh);
+                nhs->insert(nh);
             }
+            m_nexthops = std::move(nhs);
         }
     }
 
@@ -54,34 +79,46 @@ public:
         std::vector<std::string> nhv = tokenize(nexthops, NHG_DELIMITER);
         std::vector<std::string> wtv = tokenize(weights, NHG_DELIMITER);
         bool set_weight = wtv.size() == nhv.size();
+        auto nhs = std::make_shared<std::set<NextHopKey>>();
         for (uint32_t i = 0; i < nhv.size(); i++)
         {
             NextHopKey nh(nhv[i]);
             nh.weight = set_weight? (uint32_t)std::stoi(wtv[i]) : 0;
-            m_nexthops.insert(nh);
+            nhs->insert(nh);
         }
+        m_nexthops = std::move(nhs);
     }
 
     inline const std::set<NextHopKey> &getNextHops() const
     {
-        return m_nexthops;
+        return *m_nexthops;
     }
 
     inline size_t getSize() const
     {
-        return m_nexthops.size();
+        return m_nexthops->size();
     }
 
     inline bool operator<(const NextHopGroupKey &o) const
     {
-        if (m_nexthops < o.m_nexthops)
+        if (m_nexthops == o.m_nexthops)
+        {
+            return false;
+        }
+
+        if (getHash() != o.getHash())
+        {
+            return getHash() < o.getHash();
+        }
+
+        if (*m_nexthops < *o.m_nexthops)
         {
             return true;
         }
-        else if (m_nexthops == o.m_nexthops)
+        else if (*m_nexthops == *o.m_nexthops)
         {
-            auto it1 = m_nexthops.begin();
-            for (auto& it2 : o.m_nexthops)
+            auto it1 = m_nexthops->begin();
+            for (auto& it2 : *o.m_nexthops)
             {
                 if (it1->weight < it2.weight)
                 {
@@ -99,12 +136,16 @@ public:
 
     inline bool operator==(const NextHopGroupKey &o) const
     {
-        if (m_nexthops != o.m_nexthops)
+        if (m_nexthops == o.m_nexthops)
+        {
+            return true;
+        }
+        if (getHash() != o.getHash() || *m_nexthops != *o.m_nexthops)
         {
             return false;
         }
-        auto it1 = m_nexthops.begin();
-        for (auto& it2 : o.m_nexthops)
+        auto it1 = m_nexthops->begin();
+        for (auto& it2 : *o.m_nexthops)
         {
             if (it2.weight != it1->weight)
             {
@@ -122,33 +163,33 @@ public:
 
     void add(const std::string &ip, const std::string &alias)
     {
-        m_nexthops.emplace(ip, alias);
+        mutableNextHops().emplace(ip, alias);
     }
 
     void add(const std::string &nh)
     {
-        m_nexthops.insert(nh);
+        mutableNextHops().insert(nh);
     }
 
     void add(const NextHopKey &nh)
     {
-        m_nexthops.insert(nh);
+        mutableNextHops().insert(nh);
     }
 
     bool contains(const std::string &ip, const std::string &alias) const
     {
         NextHopKey nh(ip, alias);
-        return m_nexthops.find(nh) != m_nexthops.end();
+        return m_nexthops->find(nh) != m_nexthops->end();
     }
 
     bool contains(const std::string &nh) const
     {
-        return m_nexthops.find(nh) != m_nexthops.end();
+        return m_nexthops->find(nh) != m_nexthops->end();
     }
 
     bool contains(const NextHopKey &nh) const
     {
-        return m_nexthops.find(nh) != m_nexthops.end();
+        return m_nexthops->find(nh) != m_nexthops->end();
     }
 
     bool contains(const NextHopGroupKey &nhs) const
@@ -165,7 +206,7 @@ public:
 
     bool hasIntfNextHop() const
     {
-        for (const auto &nh : m_nexthops)
+        for (const auto &nh : *m_nexthops)
         {
             if (nh.isIntfNextHop())
             {
@@ -178,26 +219,26 @@ public:
     void remove(const std::string &ip, const std::string &alias)
     {
         NextHopKey nh(ip, alias);
-        m_nexthops.erase(nh);
+        mutableNextHops().erase(nh);
     }
 
     void remove(const std::string &nh)
     {
-        m_nexthops.erase(nh);
+        mutableNextHops().erase(nh);
     }
 
     void remove(const NextHopKey &nh)
     {
-        m_nexthops.erase(nh);
+        mutableNextHops().erase(nh);
     }
 
     const std::string to_string() const
     {
         string nhs_str;
 
-        for (auto it = m_nexthops.begin(); it != m_nexthops.end(); ++it)
+        for (auto it = m_nexthops->begin(); it != m_nexthops->end(); ++it)
         {
-            if (it != m_nexthops.begin())
+            if (it != m_nexthops->begin())
             {
                 nhs_str += NHG_DELIMITER;
             }
@@ -223,13 +264,156 @@ public:
 
     void clear()
     {
-        m_nexthops.clear();
+        m_nexthops = emptyNextHops();
+        m_hashed = false;
+    }
+
+    /* Hash of the next hops and their weights, equal keys have the same hash */
+    size_t getHash() const
+    {
+        if (!m_hashed)
+        {
+            std::hash<std::string> hasher;
+            size_t hash = m_nexthops->size();
+            for (const auto &nh : *m_nexthops)
+            {
+                for (size_t h : { hasher(nh.to_string(true, false)), hasher(nh.srv6_segment),
+                                  hasher(nh.srv6_source), static_cast<size_t>(nh.weight) })
+                {
+                    hash ^= h + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                }
+            }
+            m_hash = hash;
+            m_hashed = true;
+        }
+        return m_hash;
     }
 
 private:
-    std::set<NextHopKey> m_nexthops;
+    friend class NextHopGroupKeyInterner;
+
+    std::shared_ptr<std::set<NextHopKey>> m_nexthops;
     bool m_overlay_nexthops;
     bool m_srv6_nexthops;
+    mutable size_t m_hash = 0;
+    mutable bool m_hashed = false;
+
+    static const std::shared_ptr<std::set<NextHopKey>> &emptyNextHops()
+    {
+        static const std::shared_ptr<std::set<NextHopKey>> empty = std::make_shared<std::set<NextHopKey>>();
+        return empty;
+    }
+
+    /* Copy the next hops before modifying them if they are shared */
+    std::set<NextHopKey> &mutableNextHops()
+    {
+        if (m_nexthops.use_count() != 1)
+        {
+            m_nexthops = std::make_shared<std::set<NextHopKey>>(*m_nexthops);
+        }
+        m_hashed = false;
+        return *m_nexthops;
+    }
+};
+
+/*
+ * Hash-consing table of next hop group keys. Keys returned by the interner
+ * share the next hops with every other equal key it returned, and the keys
+ * built from a next hop specification string are parsed only once as long
+ * as the specification is cached.
+ *
+ * Keys no longer referenced outside of the interner are released by purge().
+ */
+class NextHopGroupKeyInterner
+{
+public:
+    static const size_t DEFAULT_PURGE_THRESHOLD = 4096;
+
+    /* Key of ip_string@if_alias separated by ',' with optional weights */
+    NextHopGroupKey get(const std::string &nexthops, const std::string &weights)
+    {
+        std::string spec = "W" + nexthops + "|" + weights;
+        auto it = m_specs.find(spec);
+        if (it != m_specs.end())
+        {
+            return it->second;
+        }
+
+        auto key = intern(NextHopGroupKey(nexthops, weights));
+        m_specs.emplace(std::move(spec), key);
+        return key;
+    }
+
+    /* Key of overlay or SRv6 next hops separated by ',' */
+    NextHopGroupKey get(const std::string &nexthops, bool overlay_nh, bool srv6_nh)
+    {
+        std::string spec = (overlay_nh ? "O" : "") + std::string(srv6_nh ? "S" : "") + "|" + nexthops;
+        auto it = m_specs.find(spec);
+        if (it != m_specs.end())
+        {
+            return it->second;
+        }
+
+        auto key = intern(NextHopGroupKey(nexthops, overlay_nh, srv6_nh));
+        m_specs.emplace(std::move(spec), key);
+        return key;
+    }
+
+    /* Return the interned key equal to the given key, interning it if needed */
+    NextHopGroupKey intern(const NextHopGroupKey &key)
+    {
+        auto it = m_keys.find(key);
+        if (it != m_keys.end() &&
+            it->m_overlay_nexthops == key.m_overlay_nexthops &&
+            it->m_srv6_nexthops == key.m_srv6_nexthops)
+        {
+            return *it;
+        }
+
+        if (it != m_keys.end())
+        {
+            return key;
+        }
+
+        return *m_keys.insert(key).first;
+    }
+
+    /*
+     * Drop the cached specifications and the keys only referenced by the
+     * interner once the cache has grown over the purge threshold.
+     */
+    void purge()
+    {
+        if (m_specs.size() + m_keys.size() < m_purgeThreshold)
+        {
+            return;
+        }
+
+        m_specs.clear();
+        for (auto it = m_keys.begin(); it != m_keys.end();)
+        {
+            if (it->m_nexthops.use_count() == 1)
+            {
+                it = m_keys.erase(it);
+            }
+            else
+            {
+                it++;
+            }
+        }
+
+        m_purgeThreshold = 2 * m_keys.size() > DEFAULT_PURGE_THRESHOLD ? 2 * m_keys.size() : DEFAULT_PURGE_THRESHOLD;
+    }
+
+    size_t size() const
+    {
+        return m_keys.size();
+    }
+
+private:
+    std::unordered_map<std::string, NextHopGroupKey> m_specs;
+    std::set<NextHopGroupKey> m_keys;
+    size_t m_purgeThreshold = DEFAULT_PURGE_THRESHOLD;
 };
 
 #endif /* SWSS_NEXTHOPGROUPKEY_H */
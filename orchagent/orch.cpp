@@ -1,6 +1,7 @@
 #include <inttypes.h>
 #include <stdexcept>
 #include <sys/time.h>
+#include <chrono>
 #include "timestamp.h"
 #include "orch.h"
 
@@ -12,6 +13,9 @@
 #include "zmqserver.h"
 #include "zmqconsumerstatetable.h"
 #include "sai_serialize.h"
+#include "redisapi.h"
+#include "rediscommand.h"
+#include "redisreply.h"
 
 using namespace swss;
 
@@ -155,9 +159,203 @@ size_t ConsumerBase::addToSync(const std::deque<KeyOpFieldsValuesTuple> &entries
     return entries.size();
 }
 
+RefillReader *ConsumerBase::s_refillReader = nullptr;
+
+RefillReader::~RefillReader()
+{
+    m_nextBatch = m_batches.size();
+    for (auto &worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void RefillReader::add(const ConsumerBase *consumer, const DBConnector *db, const string &tableName)
+{
+    m_tables.push_back({ db, tableName, {}, 0, 0, {} });
+    auto &table = m_tables.back();
+
+    Table(db, tableName).getKeys(table.keys);
+    table.batches = (table.keys.size() + REFILL_BATCH_SIZE - 1) / REFILL_BATCH_SIZE;
+
+    m_index[consumer] = &table;
+}
+
+void RefillReader::start()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto &table : m_tables)
+    {
+        for (size_t batch = 0; batch < table.batches; batch++)
+        {
+            m_batches.emplace_back(&table, batch);
+        }
+    }
+
+    if (m_batches.empty())
+    {
+        return;
+    }
+
+    try
+    {
+        m_script = swss::loadLuaScript(REFILL_BATCH_SCRIPT);
+    }
+    catch (const std::exception &e)
+    {
+        SWSS_LOG_WARN("Failed to load %s, reading back one key at a time: %s", REFILL_BATCH_SCRIPT, e.what());
+    }
+
+    size_t workers = std::min<size_t>(m_batches.size(), REFILL_MAX_WORKERS);
+    for (size_t i = 0; i < workers; i++)
+    {
+        m_workers.emplace_back(&RefillReader::work, this);
+    }
+}
+
+bool RefillReader::contains(const ConsumerBase *consumer) const
+{
+    return m_index.find(consumer) != m_index.end();
+}
+
+void RefillReader::take(const ConsumerBase *consumer,
+                        const std::function<void(const std::deque<KeyOpFieldsValuesTuple> &)> &addBatch)
+{
+    auto it = m_index.find(consumer);
+    if (it == m_index.end())
+    {
+        return;
+    }
+
+    auto &table = *it->second;
+    m_index.erase(it);
+
+    while (table.takenBatches < table.batches)
+    {
+        std::deque<std::deque<KeyOpFieldsValuesTuple>> ready;
+        {
+            std::unique_lock<std::mutex> guard(m_lock);
+            m_cv.wait(guard, [&]() { return !table.ready.empty() || m_error; });
+            if (m_error)
+            {
+                std::rethrow_exception(m_error);
+            }
+            ready.swap(table.ready);
+        }
+
+        for (const auto &entries : ready)
+        {
+            addBatch(entries);
+            table.takenBatches++;
+        }
+    }
+}
+
+void RefillReader::work()
+{
+    try
+    {
+        // The pipelines of the worker and the sha of the script on their connection
+        std::map<const DBConnector *, std::pair<std::unique_ptr<RedisPipeline>, string>> pipelines;
+
+        size_t next;
+        while ((next = m_nextBatch++) < m_batches.size())
+        {
+            auto &table = *m_batches[next].first;
+            auto &pipeline = pipelines[table.db];
+            if (!pipeline.first)
+            {
+                pipeline.first = std::make_unique<RedisPipeline>(table.db);
+                if (!m_script.empty())
+                {
+                    pipeline.second = pipeline.first->loadRedisScript(m_script);
+                }
+            }
+
+            std::deque<KeyOpFieldsValuesTuple> entries;
+            readBatch(*pipeline.first, pipeline.second, table, m_batches[next].second, entries);
+
+            std::lock_guard<std::mutex> guard(m_lock);
+            table.ready.push_back(std::move(entries));
+            m_cv.notify_all();
+        }
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        if (!m_error)
+        {
+            m_error = std::current_exception();
+        }
+        m_nextBatch = m_batches.size();
+        m_cv.notify_all();
+    }
+}
+
+void RefillReader::readBatch(RedisPipeline &pipeline, const string &sha, const TableRead &table,
+                             size_t batch, std::deque<KeyOpFieldsValuesTuple> &entries)
+{
+    size_t begin = batch * REFILL_BATCH_SIZE;
+    size_t end = std::min(begin + REFILL_BATCH_SIZE, table.keys.size());
+    Table pipelineTable(&pipeline, table.tableName, false);
+
+    if (sha.empty())
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            KeyOpFieldsValuesTuple kco;
+
+            kfvKey(kco) = table.keys[i];
+            kfvOp(kco) = SET_COMMAND;
+
+            if (!pipelineTable.get(table.keys[i], kfvFieldsValues(kco)))
+            {
+                continue;
+            }
+            entries.push_back(std::move(kco));
+        }
+        return;
+    }
+
+    vector<string> args = { "EVALSHA", sha, to_string(end - begin) };
+    for (size_t i = begin; i < end; i++)
+    {
+        args.push_back(pipelineTable.getKeyName(table.keys[i]));
+    }
+
+    RedisCommand command;
+    command.format(args);
+    RedisReply r(pipeline.push(command, REDIS_REPLY_ARRAY));
+    redisReply *reply = r.getContext();
+
+    // One list of fields and values per key, empty for the keys removed since getKeys()
+    for (size_t i = 0; i < std::min(reply->elements, end - begin); i++)
+    {
+        const redisReply *fields = reply->element[i];
+        if (fields->elements == 0)
+        {
+            continue;
+        }
+
+        KeyOpFieldsValuesTuple kco;
+
+        kfvKey(kco) = table.keys[begin + i];
+        kfvOp(kco) = SET_COMMAND;
+        for (size_t j = 0; j + 1 < fields->elements; j += 2)
+        {
+            kfvFieldsValues(kco).emplace_back(string(fields->element[j]->str, fields->element[j]->len),
+                                              string(fields->element[j + 1]->str, fields->element[j + 1]->len));
+        }
+        entries.push_back(std::move(kco));
+    }
+}
+
 // TODO: Table should be const
 size_t ConsumerBase::refillToSync(Table* table)
 {
+    auto start = std::chrono::steady_clock::now();
+
     std::deque<KeyOpFieldsValuesTuple> entries;
     vector<string> keys;
     table->getKeys(keys);
@@ -175,7 +373,74 @@ size_t ConsumerBase::refillToSync(Table* table)
         entries.push_back(kco);
     }
 
-    return addToSync(entries);
+    size_t refilled = addToSync(entries);
+
+    m_refilled += refilled;
+    m_refillTimeMs += std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    return refilled;
+}
+
+/*
+ * Read back the table with a RefillReader, or take it from the reader it was
+ * queued in ahead of the call. The batches are added to m_toSync by the
+ * calling thread as soon as they are read.
+ */
+size_t ConsumerBase::refillToSync(const DBConnector *db, const string &tableName)
+{
+    auto start = std::chrono::steady_clock::now();
+    size_t refilled = 0;
+
+    auto addBatch = [&](const std::deque<KeyOpFieldsValuesTuple> &entries)
+    {
+        refilled += addToSync(entries);
+    };
+
+    if (s_refillReader != nullptr && s_refillReader->contains(this))
+    {
+        s_refillReader->take(this, addBatch);
+    }
+    else
+    {
+        RefillReader reader;
+        reader.add(this, db, tableName);
+        reader.start();
+        reader.take(this, addBatch);
+    }
+
+    m_refilled += refilled;
+    m_refillTimeMs += std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    return refilled;
+}
+
+const DBConnector *ConsumerBase::getRefillDbConnector() const
+{
+    auto consumerTable = dynamic_cast<ConsumerTableBase *>(getSelectable());
+    if (consumerTable != NULL)
+    {
+        // consumerTable is either ConsumerStateTable or ConsumerTable
+        return consumerTable->getDbConnector();
+    }
+    auto zmqTable = dynamic_cast<ZmqConsumerStateTable *>(getSelectable());
+    if (zmqTable != NULL)
+    {
+        return zmqTable->getDbConnector();
+    }
+    return nullptr;
+}
+
+void ConsumerBase::addRefillTable(RefillReader &reader)
+{
+    // The subscriber tables are read back from their own connection by refillToSync()
+    if (dynamic_cast<SubscriberStateTable *>(getSelectable()) != NULL)
+    {
+        return;
+    }
+
+    auto db = getRefillDbConnector();
+    if (db != nullptr)
+    {
+        reader.add(this, db, getTableName());
+    }
 }
 
 size_t ConsumerBase::refillToSync()
@@ -183,6 +448,7 @@ size_t ConsumerBase::refillToSync()
     auto subTable = dynamic_cast<SubscriberStateTable *>(getSelectable());
     if (subTable != NULL)
     {
+        auto start = std::chrono::steady_clock::now();
         size_t update_size = 0;
         size_t total_size = 0;
         do
@@ -192,23 +458,16 @@ size_t ConsumerBase::refillToSync()
             update_size = addToSync(entries);
             total_size += update_size;
         } while (update_size != 0);
+
+        m_refilled += total_size;
+        m_refillTimeMs += std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
         return total_size;
     }
-    string tableName = getTableName();
-    auto consumerTable = dynamic_cast<ConsumerTableBase *>(getSelectable());
-    if (consumerTable != NULL)
-    {
-        // consumerTable is either ConsumerStateTable or ConsumerTable
-        auto db = consumerTable->getDbConnector();
-        auto table = Table(db, tableName);
-        return refillToSync(&table);
-    }
-    auto zmqTable = dynamic_cast<ZmqConsumerStateTable *>(getSelectable());
-    if (zmqTable != NULL)
+
+    auto db = getRefillDbConnector();
+    if (db != nullptr)
     {
-        auto db = zmqTable->getDbConnector();
-        auto table = Table(db, tableName);
-        return refillToSync(&table);
+        return refillToSync(db, getTableName());
     }
     return 0;
 }
@@ -300,13 +559,28 @@ bool Orch::bake()
             continue;
         }
 
+        auto start = std::chrono::steady_clock::now();
         size_t refilled = consumer->refillToSync();
-        SWSS_LOG_NOTICE("Add warm input: %s, %zd", executorName.c_str(), refilled);
+        auto refill_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        SWSS_LOG_NOTICE("Add warm input: %s, %zd in %" PRId64 " ms", executorName.c_str(), refilled,
+                        static_cast<int64_t>(refill_time));
     }
 
     return true;
 }
 
+void Orch::addRefillTables(RefillReader &reader)
+{
+    for (auto &it : m_consumerMap)
+    {
+        auto consumer = dynamic_cast<ConsumerBase *>(it.second.get());
+        if (consumer != NULL)
+        {
+            consumer->addRefillTable(reader);
+        }
+    }
+}
+
 /*
 - Validates reference has proper format which is object_name
 - validates table_name exists
@@ -557,11 +831,53 @@ void Orch::dumpPendingTasks(vector<string> &ts)
     }
 }
 
+size_t Orch::getPendingTaskCount()
+{
+    size_t count = 0;
+
+    for (auto &it : m_consumerMap)
+    {
+        ConsumerBase* consumer = dynamic_cast<ConsumerBase *>(it.second.get());
+        if (consumer != NULL)
+        {
+            count += consumer->m_toSync.size();
+        }
+    }
+
+    return count;
+}
+
+void Orch::dumpRefillStats(std::map<std::string, std::pair<size_t, uint64_t>> &stats)
+{
+    for (auto &it : m_consumerMap)
+    {
+        ConsumerBase* consumer = dynamic_cast<ConsumerBase *>(it.second.get());
+        if (consumer == NULL || consumer->getRefilledCount() == 0)
+        {
+            continue;
+        }
+
+        auto &table_stats = stats[it.first];
+        table_stats.first += consumer->getRefilledCount();
+        table_stats.second += consumer->getRefillTimeMs();
+    }
+}
+
 void Orch::flushResponses()
 {
     m_publisher.flush();
 }
 
+void Orch::setResponseZmqClient(ZmqClient *zmqClient)
+{
+    m_publisher.setZmqClient(zmqClient);
+}
+
+void Orch::flushStateWrites()
+{
+    m_stateWriter.flush();
+}
+
 ref_resolve_status Orch::resolveFieldRefArray(
     type_map &type_maps,
     const string &field_name,
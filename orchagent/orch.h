@@ -7,6 +7,13 @@
 #include <set>
 #include <memory>
 #include <utility>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 extern "C" {
 #include <sai.h>
@@ -14,6 +21,7 @@ extern "C" {
 }
 
 #include "dbconnector.h"
+#include "redispipeline.h"
 #include "table.h"
 #include "consumertable.h"
 #include "consumerstatetable.h"
@@ -23,6 +31,7 @@ extern "C" {
 #include "selectabletimer.h"
 #include "macaddress.h"
 #include "response_publisher.h"
+#include "statewriter.h"
 #include "recorder.h"
 
 const char delimiter           = ':';
@@ -51,6 +60,13 @@ const char state_db_key_delimiter  = '|';
 
 const int default_orch_pri = 0;
 
+/* Keys read back from a table at warm restart with one script call */
+#define REFILL_BATCH_SIZE   1024
+/* Maximum number of threads reading back the tables at warm restart */
+#define REFILL_MAX_WORKERS  8
+/* Script returning the fields of a batch of keys */
+#define REFILL_BATCH_SCRIPT "refill_batch.lua"
+
 typedef enum
 {
     task_success,
@@ -135,6 +151,66 @@ protected:
     swss::Selectable *getSelectable() const { return m_selectable; }
 };
 
+class ConsumerBase;
+
+/*
+ * Reads back the tables of the consumers at warm restart. The tables are read
+ * in batches of REFILL_BATCH_SIZE keys by up to REFILL_MAX_WORKERS threads
+ * shared by all the tables, each with its own RedisPipeline per DB, and each
+ * batch is read with one call of REFILL_BATCH_SCRIPT. The batches are handed
+ * over to the thread calling take(), the only one touching the consumers.
+ */
+class RefillReader
+{
+public:
+    RefillReader() = default;
+    ~RefillReader();
+
+    RefillReader(const RefillReader&) = delete;
+    RefillReader& operator=(const RefillReader&) = delete;
+
+    /* Queue the table of the consumer, the tables added after start() are not read */
+    void add(const ConsumerBase *consumer, const swss::DBConnector *db, const std::string &tableName);
+    void start();
+
+    /* Whether the table of the consumer is read and not taken yet */
+    bool contains(const ConsumerBase *consumer) const;
+
+    /* Pass the batches of the table of the consumer to addBatch as they are read, until the table is read */
+    void take(const ConsumerBase *consumer,
+              const std::function<void(const std::deque<swss::KeyOpFieldsValuesTuple> &)> &addBatch);
+
+    size_t getWorkerCount() const { return m_workers.size(); }
+
+private:
+    struct TableRead
+    {
+        const swss::DBConnector *db;
+        std::string tableName;
+        std::vector<std::string> keys;
+        size_t batches;
+        size_t takenBatches;
+        std::deque<std::deque<swss::KeyOpFieldsValuesTuple>> ready;
+    };
+
+    void work();
+    void readBatch(swss::RedisPipeline &pipeline, const std::string &sha, const TableRead &table,
+                   size_t batch, std::deque<swss::KeyOpFieldsValuesTuple> &entries);
+
+    std::deque<TableRead> m_tables;
+    std::map<const ConsumerBase *, TableRead *> m_index;
+
+    /* Batches to read, as table and batch index, and the next one to read */
+    std::vector<std::pair<TableRead *, size_t>> m_batches;
+    std::atomic<size_t> m_nextBatch {0};
+    std::string m_script;
+
+    std::mutex m_lock;
+    std::condition_variable m_cv;
+    std::exception_ptr m_error;
+    std::vector<std::thread> m_workers;
+};
+
 class ConsumerBase : public Executor {
 public:
     ConsumerBase(swss::Selectable *selectable, Orch *orch, const std::string &name)
@@ -166,6 +242,25 @@ public:
 
     size_t refillToSync();
     size_t refillToSync(swss::Table* table);
+
+    /* Queue the table read back by refillToSync() in the reader */
+    void addRefillTable(RefillReader &reader);
+
+    /* Reader of the tables queued ahead of the calls of refillToSync(), if any */
+    static void setRefillReader(RefillReader *reader) { s_refillReader = reader; }
+
+    /* Entries read back by refillToSync() and the time it took */
+    size_t getRefilledCount() const { return m_refilled; }
+    uint64_t getRefillTimeMs() const { return m_refillTimeMs; }
+
+private:
+    size_t refillToSync(const swss::DBConnector *db, const std::string &tableName);
+    const swss::DBConnector *getRefillDbConnector() const;
+
+    size_t m_refilled = 0;
+    uint64_t m_refillTimeMs = 0;
+
+    static RefillReader *s_refillReader;
 };
 
 class Consumer : public ConsumerBase {
@@ -235,6 +330,9 @@ public:
     // otherwise fallback to cold start
     virtual bool bake();
 
+    // Queue the tables of the consumers in the reader, for bake() to add them without waiting for their reads
+    void addRefillTables(RefillReader &reader);
+
     /* Iterate all consumers in m_consumerMap and run doTask(Consumer) */
     virtual void doTask();
 
@@ -244,11 +342,26 @@ public:
     virtual void doTask(swss::SelectableTimer &timer) { }
 
     void dumpPendingTasks(std::vector<std::string> &ts);
+    size_t getPendingTaskCount();
+
+    /* Get the entries read back and the restore time in ms of each table at warm restart */
+    void dumpRefillStats(std::map<std::string, std::pair<size_t, uint64_t>> &stats);
 
     /**
      * @brief Flush pending responses
      */
     void flushResponses();
+
+    /**
+     * @brief Send the responses to a ZMQ client instead of the redis channels
+     */
+    virtual void setResponseZmqClient(swss::ZmqClient *zmqClient);
+
+    /**
+     * @brief Write the state table updates buffered in m_stateWriter
+     */
+    void flushStateWrites();
+    const StateWriter &getStateWriter() const { return m_stateWriter; }
 protected:
     ConsumerMap m_consumerMap;
 
@@ -272,6 +385,8 @@ protected:
     Executor *getExecutor(std::string executorName);
 
     ResponsePublisher m_publisher{"APPL_STATE_DB"};
+    /* Updates of the state tables, written at the end of the loop iteration of OrchDaemon */
+    StateWriter m_stateWriter;
 private:
     void addConsumer(swss::DBConnector *db, std::string tableName, int pri = default_orch_pri);
 };
@@ -1,4 +1,6 @@
+#include <inttypes.h>
 #include <unistd.h>
+#include <algorithm>
 #include <unordered_map>
 #include <chrono>
 #include <limits.h>
@@ -22,12 +24,19 @@ using namespace swss;
 #define APP_FABRIC_MONITOR_PORT_TABLE_NAME      "FABRIC_PORT_TABLE"
 #define APP_FABRIC_MONITOR_DATA_TABLE_NAME      "FABRIC_MONITOR_TABLE"
 
+/* Per table statistics of the orchagent warm restart state restore */
+#define STATE_WARM_RESTART_RESTORE_TABLE_NAME   "WARM_RESTART_RESTORE_TABLE"
+
+/* Maximum number of passes over the orchs to process the warm restart backlog */
+#define WARM_RESTORE_MAX_PASSES 32
+
 /* orchagent heart beat message interval */
 #define HEART_BEAT_INTERVAL_MSECS 10 * 1000
 
 extern sai_switch_api_t*           sai_switch_api;
 extern sai_object_id_t             gSwitchId;
 extern string                      gMySwitchType;
+extern bool                        gCounterRatesInOrch;
 
 extern void syncd_apply_view();
 /*
@@ -544,6 +553,13 @@ bool OrchDaemon::init()
     auto* flexCounterOrch = new FlexCounterOrch(m_configDb, flex_counter_tables);
     m_orchList.push_back(flexCounterOrch);
 
+    if (gCounterRatesInOrch)
+    {
+        auto* counterRateOrch = new CounterRateOrch();
+        m_orchList.push_back(counterRateOrch);
+        gDirectory.set(counterRateOrch);
+    }
+
     gDirectory.set(flexCounterOrch);
     gDirectory.set(gPortsOrch);
 
@@ -768,6 +784,19 @@ bool OrchDaemon::init()
     TwampOrch *twamp_orch = new TwampOrch(confDbTwampTable, stateDbTwampTable, gSwitchOrch, gPortsOrch, vrf_orch);
     m_orchList.push_back(twamp_orch);
 
+    /*
+     * Dependencies of the warm restart backlog processing. MirrorOrch depends on
+     * everything else being settled before it can run.
+     */
+    addOrchDependency(gIntfsOrch, gPortsOrch);
+    addOrchDependency(gNeighOrch, gIntfsOrch);
+    addOrchDependency(gRouteOrch, gNeighOrch);
+    addOrchDependency(gRouteOrch, gNhgOrch);
+    for (Orch *o : m_orchList)
+    {
+        addOrchDependency(gMirrorOrch, o);
+    }
+
     if (WarmStart::isWarmStart())
     {
         bool suc = warmRestoreAndSyncUp();
@@ -777,6 +806,18 @@ bool OrchDaemon::init()
         }
     }
 
+    /* The P4RT and DASH controllers get the responses of their orchs over ZMQ */
+    if (m_responseZmqClient != nullptr)
+    {
+        for (Orch *orch : m_orchList)
+        {
+            if (orch == gP4Orch || dynamic_cast<ZmqOrch *>(orch) != nullptr)
+            {
+                orch->setResponseZmqClient(m_responseZmqClient);
+            }
+        }
+    }
+
     return true;
 }
 
@@ -797,6 +838,7 @@ void OrchDaemon::flush()
     for (auto* orch: m_orchList)
     {
         orch->flushResponses();
+        orch->flushStateWrites();
     }
 }
 
@@ -881,6 +923,10 @@ void OrchDaemon::start()
         for (Orch *o : m_orchList)
             o->doTask();
 
+        /* Write the state updates of the iteration, collapsed per key */
+        for (Orch *o : m_orchList)
+            o->flushStateWrites();
+
         /*
          * Asked to check warm restart readiness.
          * Not doing this under Select::TIMEOUT condition because of
@@ -927,42 +973,58 @@ bool OrchDaemon::warmRestoreAndSyncUp()
 {
     WarmStart::setWarmStartState("orchagent", WarmStart::INITIALIZED);
 
+    auto start = chrono::steady_clock::now();
+
+    /* Read back the tables of all the orchs concurrently, bake() adds them to the consumers */
+    RefillReader refillReader;
     for (Orch *o : m_orchList)
     {
-        o->bake();
+        o->addRefillTables(refillReader);
     }
+    refillReader.start();
 
-    /*
-     * Three iterations are needed.
-     *
-     * First iteration: switchorch, Port init/hostif create part of portorch, buffers configuration
-     *
-     * Second iteration: port speed/mtu/fec_mode/pfc_asym/admin_status config,
-     * other orch(s) which wait for port to become ready.
-     *
-     * Third iteration: Drain remaining data that are out of order.
-     */
-
-    for (auto it = 0; it < 3; it++)
+    ConsumerBase::setRefillReader(&refillReader);
+    for (Orch *o : m_orchList)
     {
-        SWSS_LOG_DEBUG("The current doTask iteration is %d", it);
+        o->bake();
+    }
+    ConsumerBase::setRefillReader(nullptr);
+    auto restore_time = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
 
-        for (Orch *o : m_orchList)
-        {
-            if (o == gMirrorOrch) {
-                SWSS_LOG_DEBUG("Skipping mirror processing until the end");
-                continue;
-            }
+    /* Publish the number of entries restored and the restore time of each table */
+    map<string, pair<size_t, uint64_t>> refill_stats;
+    for (Orch *o : m_orchList)
+    {
+        o->dumpRefillStats(refill_stats);
+    }
 
-            o->doTask();
-        }
+    Table restoreTable(m_stateDb, STATE_WARM_RESTART_RESTORE_TABLE_NAME);
+    size_t restored = 0;
+    for (const auto &it : refill_stats)
+    {
+        SWSS_LOG_NOTICE("Restored %zu entries of %s in %" PRIu64 " ms", it.second.first, it.first.c_str(), it.second.second);
+        restoreTable.set(it.first, {
+            { "entries", to_string(it.second.first) },
+            { "restore_time_ms", to_string(it.second.second) }
+        });
+        restored += it.second.first;
     }
+    SWSS_LOG_NOTICE("Restored %zu entries in %" PRId64 " ms", restored, static_cast<int64_t>(restore_time));
+
+    Table warmRestartTable(m_stateDb, STATE_WARM_RESTART_TABLE_NAME);
+    warmRestartTable.set("orchagent", {
+        { "restored_entries", to_string(restored) },
+        { "restore_time_ms", to_string(restore_time) }
+    });
 
-    // MirrorOrch depends on everything else being settled before it can run,
-    // and mirror ACL rules depend on MirrorOrch, so run these two at the end
-    // after the rest of the data has been processed.
-    gMirrorOrch->doTask();
-    gAclOrch->doTask();
+    /*
+     * Process the restored data in dependency order until no orch makes progress.
+     * Mirror ACL rules waiting for MirrorOrch are retried once it has run.
+     */
+    size_t pending = processWarmRestoreTasks();
+    warmRestartTable.set("orchagent", {
+        { "pending_tasks", to_string(pending) }
+    });
 
     /*
      * At this point, all the pre-existing data should have been processed properly, and
@@ -991,6 +1053,172 @@ bool OrchDaemon::warmRestoreAndSyncUp()
     return true;
 }
 
+void OrchDaemon::addOrchDependency(Orch *orch, Orch *dependency)
+{
+    if (orch == nullptr || dependency == nullptr || orch == dependency)
+    {
+        return;
+    }
+
+    m_orchDependencies[orch].insert(dependency);
+}
+
+/*
+ * Order m_orchList so that every orch comes after the orchs it depends on.
+ * Orchs are otherwise kept in the order of m_orchList. Orchs in a dependency
+ * loop are kept in the order of m_orchList too.
+ */
+vector<Orch *> OrchDaemon::getWarmRestoreOrder()
+{
+    vector<Orch *> order;
+    set<Orch *> added;
+    set<Orch *> orchs(m_orchList.begin(), m_orchList.end());
+
+    while (order.size() < m_orchList.size())
+    {
+        bool found = false;
+        for (Orch *o : m_orchList)
+        {
+            if (added.count(o))
+            {
+                continue;
+            }
+
+            bool ready = true;
+            for (Orch *dependency : m_orchDependencies[o])
+            {
+                if (orchs.count(dependency) && !added.count(dependency))
+                {
+                    ready = false;
+                    break;
+                }
+            }
+
+            if (ready)
+            {
+                order.push_back(o);
+                added.insert(o);
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+        {
+            SWSS_LOG_WARN("Dependency loop between orchs, keeping the remaining orchs in order");
+            for (Orch *o : m_orchList)
+            {
+                if (added.insert(o).second)
+                {
+                    order.push_back(o);
+                }
+            }
+        }
+    }
+
+    return order;
+}
+
+/*
+ * Process the warm restart backlog until no orch makes progress anymore, and
+ * return the number of tasks left.
+ *
+ * Orchs are processed in dependency order. An orch is processed only once the
+ * orchs it depends on are settled, i.e. they have no pending task or their
+ * last doTask() made no progress. An orch whose last doTask() made no progress
+ * is only processed again after another orch made progress. If no orch makes
+ * progress while some are waiting for their dependencies, the waiting orchs
+ * are processed anyway.
+ */
+size_t OrchDaemon::processWarmRestoreTasks()
+{
+    struct WarmRestoreState
+    {
+        bool run = false;
+        bool progress = false;
+        uint64_t seen_progress = 0;
+    };
+
+    auto order = getWarmRestoreOrder();
+    map<Orch *, WarmRestoreState> states;
+    for (Orch *o : order)
+    {
+        states[o];
+    }
+
+    uint64_t progress_count = 0;
+    bool force = false;
+    int pass;
+
+    auto isSettled = [&](Orch *o)
+    {
+        auto state = states.find(o);
+        return state == states.end() || o->getPendingTaskCount() == 0 ||
+               (state->second.run && !state->second.progress);
+    };
+
+    for (pass = 0; pass < WARM_RESTORE_MAX_PASSES; pass++)
+    {
+        bool progress = false;
+        bool deferred = false;
+        size_t executed = 0;
+
+        for (Orch *o : order)
+        {
+            auto &state = states[o];
+            size_t pending = o->getPendingTaskCount();
+
+            if (state.run && (pending == 0 || (!state.progress && state.seen_progress == progress_count)))
+            {
+                continue;
+            }
+
+            if (!force && !all_of(m_orchDependencies[o].begin(), m_orchDependencies[o].end(), isSettled))
+            {
+                deferred = true;
+                continue;
+            }
+
+            o->doTask();
+            executed++;
+
+            state.run = true;
+            state.progress = o->getPendingTaskCount() != pending;
+            if (state.progress)
+            {
+                progress = true;
+                progress_count++;
+            }
+            state.seen_progress = progress_count;
+        }
+
+        SWSS_LOG_NOTICE("Warm restore pass %d processed %zu orchs%s", pass, executed, force ? " ignoring dependencies" : "");
+
+        if (!progress && (!deferred || force))
+        {
+            break;
+        }
+        force = !progress && deferred;
+    }
+
+    size_t pending = 0;
+    for (Orch *o : order)
+    {
+        pending += o->getPendingTaskCount();
+    }
+
+    if (pass == WARM_RESTORE_MAX_PASSES)
+    {
+        SWSS_LOG_WARN("Warm restore didn't settle after %d passes, %zu tasks pending", pass, pending);
+    }
+    else
+    {
+        SWSS_LOG_NOTICE("Warm restore settled after %d passes, %zu tasks pending", pass + 1, pending);
+    }
+
+    return pending;
+}
+
 /*
  * Get tasks to sync for consumers of each orch being managed by this orch daemon
  */
@@ -5,6 +5,7 @@
 #include "producerstatetable.h"
 #include "consumertable.h"
 #include "zmqserver.h"
+#include "zmqclient.h"
 #include "select.h"
 
 #include "portsorch.h"
@@ -13,6 +14,7 @@
 #include "neighorch.h"
 #include "routeorch.h"
 #include "flowcounterrouteorch.h"
+#include "counterrateorch.h"
 #include "nhgorch.h"
 #include "cbf/cbfnhgorch.h"
 #include "cbf/nhgmaporch.h"
@@ -64,12 +66,15 @@ public:
     virtual bool init();
     void start();
     bool warmRestoreAndSyncUp();
+    size_t processWarmRestoreTasks();
     void getTaskToSync(vector<string> &ts);
     bool warmRestoreValidation();
 
     bool warmRestartCheck();
 
     void addOrchList(Orch* o);
+    // Process the warm restart backlog of orch after the one of dependency
+    void addOrchDependency(Orch *orch, Orch *dependency);
     void setFabricEnabled(bool enabled)
     {
         m_fabricEnabled = enabled;
@@ -82,6 +87,11 @@ public:
     {
         m_fabricQueueStatEnabled = enabled;
     }
+    // Send the responses of the P4RT and DASH orchs to their controllers over ZMQ
+    void setResponseZmqClient(ZmqClient *zmqClient)
+    {
+        m_responseZmqClient = zmqClient;
+    }
     void logRotate();
 private:
     DBConnector *m_applDb;
@@ -89,18 +99,22 @@ private:
     DBConnector *m_stateDb;
     DBConnector *m_chassisAppDb;
     ZmqServer *m_zmqServer;
+    ZmqClient *m_responseZmqClient = nullptr;
 
     bool m_fabricEnabled = false;
     bool m_fabricPortStatEnabled = true;
     bool m_fabricQueueStatEnabled = true;
 
     std::vector<Orch *> m_orchList;
+    std::map<Orch *, std::set<Orch *>> m_orchDependencies;
     Select *m_select;
     
     std::chrono::time_point<std::chrono::high_resolution_clock> m_lastHeartBeat;
 
     void flush();
 
+    std::vector<Orch *> getWarmRestoreOrder();
+
     void heartBeat(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent);
 
     void freezeAndHeartBeat(unsigned int duration);
@@ -282,3 +282,9 @@ GreTunnelManager *P4Orch::getGreTunnelManager()
 {
     return m_greTunnelManager.get();
 }
+
+void P4Orch::setResponseZmqClient(swss::ZmqClient *zmqClient)
+{
+    // The P4RT responses are sent by the APPL_DB publisher of P4Orch.
+    m_publisher.setZmqClient(zmqClient);
+}
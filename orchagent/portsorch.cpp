@@ -17,6 +17,7 @@
 #include <tuple>
 #include <sstream>
 #include <unordered_set>
+#include <unordered_map>
 
 #include <netinet/if_ether.h>
 #include "net/if.h"
@@ -28,6 +29,7 @@
 #include "sai_serialize.h"
 #include "crmorch.h"
 #include "countercheckorch.h"
+#include "counterrateorch.h"
 #include "notifier.h"
 #include "fdborch.h"
 #include "switchorch.h"
@@ -62,6 +64,7 @@ extern int32_t gVoqMySwitchId;
 extern string gMyHostName;
 extern string gMyAsicName;
 extern event_handle_t g_events_handle;
+extern bool gCounterRatesInOrch;
 
 // defines ------------------------------------------------------------------------------------------------------------
 
@@ -530,6 +533,12 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
 
     /* Initialize port and vlan table */
     m_portTable = unique_ptr<Table>(new Table(db, APP_PORT_TABLE_NAME));
+
+    /* Initialize the buffered tables of the port oper status notifications */
+    m_operStatusApplPipeline = unique_ptr<RedisPipeline>(new RedisPipeline(db));
+    m_operStatusStatePipeline = unique_ptr<RedisPipeline>(new RedisPipeline(stateDb));
+    m_operStatusPortTable = unique_ptr<Table>(new Table(m_operStatusApplPipeline.get(), APP_PORT_TABLE_NAME, true));
+    m_operStatusPortStateTable = unique_ptr<Table>(new Table(m_operStatusStatePipeline.get(), STATE_PORT_TABLE_NAME, true));
     m_sendToIngressPortTable = unique_ptr<Table>(new Table(db, APP_SEND_TO_INGRESS_PORT_TABLE_NAME));
 
     /* Initialize gearbox */
@@ -555,7 +564,7 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
     string queueWmSha, pgWmSha, portRateSha;
     string queueWmPluginName = "watermark_queue.lua";
     string pgWmPluginName = "watermark_pg.lua";
-    string portRatePluginName = "port_rates.lua";
+    string portRatePluginName = gCounterRatesInOrch ? COUNTER_RATES_POLL_PLUGIN : "port_rates.lua";
 
     try
     {
@@ -1957,6 +1966,7 @@ bool PortsOrch::setPortPfc(sai_object_id_t portId, uint8_t pfc_bitmask)
     {
         p.m_pfc_bitmask = pfc_bitmask;
         m_portList[p.m_alias] = p;
+        CounterCheckOrch::getInstance().updatePortPfc(portId, pfc_bitmask);
     }
 
     return true;
@@ -3346,7 +3356,7 @@ void PortsOrch::updateDbPortFlapCount(Port& port, sai_port_oper_status_t pstatus
         FieldValueTuple tuple("last_up_time", buffer);
         tuples.push_back(tuple);
     }
-    m_portTable->set(port.m_alias, tuples);
+    (m_operStatusBatch ? *m_operStatusPortTable : *m_portTable).set(port.m_alias, tuples);
 }
 
 void PortsOrch::updateDbPortOperStatus(const Port& port, sai_port_oper_status_t status) const
@@ -3363,7 +3373,7 @@ void PortsOrch::updateDbPortOperStatus(const Port& port, sai_port_oper_status_t
     vector<FieldValueTuple> tuples;
     FieldValueTuple tuple("oper_status", oper_status_strings.at(status));
     tuples.push_back(tuple);
-    m_portTable->set(port.m_alias, tuples);
+    (m_operStatusBatch ? *m_operStatusPortTable : *m_portTable).set(port.m_alias, tuples);
 }
 
 sai_status_t PortsOrch::removePort(sai_object_id_t port_id)
@@ -7997,23 +8007,80 @@ void PortsOrch::doTask(NotificationConsumer &consumer)
         return;
     }
 
+    if (&consumer == m_portStatusNotificationConsumer)
+    {
+        doPortOperStatusTask(consumer);
+        return;
+    }
+
     std::string op;
     std::string data;
     std::vector<swss::FieldValueTuple> values;
 
     consumer.pop(op, data, values);
 
-    if (&consumer != m_portStatusNotificationConsumer && &consumer != m_portHostTxReadyNotificationConsumer)
+    if (&consumer != m_portHostTxReadyNotificationConsumer)
     {
         return;
     }
 
-    if (&consumer == m_portStatusNotificationConsumer && op == "port_state_change")
+    if (op == "port_host_tx_ready")
+    {
+        sai_object_id_t port_id;
+        sai_object_id_t switch_id;
+        sai_port_host_tx_ready_status_t host_tx_ready_status;
+
+        sai_deserialize_port_host_tx_ready_ntf(data, switch_id, port_id, host_tx_ready_status);
+        SWSS_LOG_DEBUG("Recieved host_tx_ready notification for port 0x%" PRIx64, port_id);
+
+        Port p;
+        if (!getPort(port_id, p))
+        {
+            SWSS_LOG_ERROR("Failed to get port object for port id 0x%" PRIx64, port_id);
+            return;
+        }
+        setHostTxReady(p, host_tx_ready_status == SAI_PORT_HOST_TX_READY_STATUS_READY ? "true" : "false");
+    }
+
+}
+
+/*
+ * Process all the pending port state change notifications at once. Only the
+ * final state of each port is acted on: a port flapping several times within
+ * the batch is updated and reported to the observers once, while its flap
+ * count still accounts for every transition.
+ */
+void PortsOrch::doPortOperStatusTask(NotificationConsumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    struct OperStatusChange
     {
+        sai_port_oper_status_t first;
+        sai_port_oper_status_t last;
+        /* Number of status changes between the notifications of the batch */
+        uint32_t changes;
+        uint32_t notifications;
+    };
+
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
+
+    /* Ports in the order they were first reported */
+    std::vector<sai_object_id_t> port_ids;
+    std::unordered_map<sai_object_id_t, OperStatusChange> changes;
+
+    for (const auto &entry : entries)
+    {
+        if (kfvOp(entry) != "port_state_change")
+        {
+            continue;
+        }
+
         uint32_t count;
         sai_port_oper_status_notification_t *portoperstatus = nullptr;
 
-        sai_deserialize_port_oper_status_ntf(data, count, &portoperstatus);
+        sai_deserialize_port_oper_status_ntf(kfvKey(entry), count, &portoperstatus);
 
         for (uint32_t i = 0; i < count; i++)
         {
@@ -8022,69 +8089,85 @@ void PortsOrch::doTask(NotificationConsumer &consumer)
 
             SWSS_LOG_NOTICE("Get port state change notification id:%" PRIx64 " status:%d", id, status);
 
-            Port port;
-
-            if (!getPort(id, port))
+            auto it = changes.find(id);
+            if (it == changes.end())
             {
-                SWSS_LOG_NOTICE("Got port state change for port id 0x%" PRIx64 " which does not exist, possibly outdated event", id);
+                changes.emplace(id, OperStatusChange{ status, status, 0, 1 });
+                port_ids.push_back(id);
                 continue;
             }
 
-            updatePortOperStatus(port, status);
-            if (status == SAI_PORT_OPER_STATUS_UP)
+            if (it->second.last != status)
             {
-                sai_uint32_t speed;
-                if (getPortOperSpeed(port, speed))
-                {
-                    SWSS_LOG_NOTICE("%s oper speed is %d", port.m_alias.c_str(), speed);
-                    updateDbPortOperSpeed(port, speed);
-                }
-                else
-                {
-                    updateDbPortOperSpeed(port, 0);
-                }
-                sai_port_fec_mode_t fec_mode;
-                string fec_str;
-                if (oper_fec_sup && getPortOperFec(port, fec_mode))
-                {
-                    if (!m_portHlpr.fecToStr(fec_str, fec_mode))
-                    {
-                        SWSS_LOG_ERROR("Error unknown fec mode %d while querying port %s fec mode",
-                                       static_cast<std::int32_t>(fec_mode), port.m_alias.c_str());
-                        fec_str = "N/A";
-                    }
-                    updateDbPortOperFec(port,fec_str);
-                }
-                else
-                {
-                    updateDbPortOperFec(port, "N/A");
-                }
+                it->second.changes++;
+                it->second.last = status;
             }
-
-            /* update m_portList */
-            m_portList[port.m_alias] = port;
+            it->second.notifications++;
         }
 
         sai_deserialize_free_port_oper_status_ntf(count, portoperstatus);
     }
-    else if (&consumer == m_portHostTxReadyNotificationConsumer && op == "port_host_tx_ready")
+
+    beginOperStatusBatch();
+
+    std::vector<Port> ports_up;
+    for (auto id : port_ids)
     {
-        sai_object_id_t port_id;
-        sai_object_id_t switch_id;
-        sai_port_host_tx_ready_status_t host_tx_ready_status;
+        const auto &change = changes.at(id);
+        sai_port_oper_status_t status = change.last;
 
-        sai_deserialize_port_host_tx_ready_ntf(data, switch_id, port_id, host_tx_ready_status);
-        SWSS_LOG_DEBUG("Recieved host_tx_ready notification for port 0x%" PRIx64, port_id);
+        Port port;
 
-        Port p;
-        if (!getPort(port_id, p))
+        if (!getPort(id, port))
         {
-            SWSS_LOG_ERROR("Failed to get port object for port id 0x%" PRIx64, port_id);
-            return;
+            SWSS_LOG_NOTICE("Got port state change for port id 0x%" PRIx64 " which does not exist, possibly outdated event", id);
+            continue;
         }
-        setHostTxReady(p, host_tx_ready_status == SAI_PORT_HOST_TX_READY_STATUS_READY ? "true" : "false");
+
+        uint32_t flaps = change.changes + (change.first != port.m_oper_status ? 1 : 0);
+        if (change.notifications > 1)
+        {
+            SWSS_LOG_NOTICE("Coalesced %u state change notifications of port %s with %u transitions",
+                    change.notifications, port.m_alias.c_str(), flaps);
+        }
+
+        if (port.m_type == Port::PHY && flaps > 1)
+        {
+            /* The last transition is accounted by updatePortOperStatus */
+            port.m_flap_count += flaps - 1;
+            if (status == port.m_oper_status)
+            {
+                updateDbPortFlapCount(port, status);
+            }
+        }
+
+        updatePortOperStatus(port, status);
+        if (status == SAI_PORT_OPER_STATUS_UP)
+        {
+            ports_up.push_back(port);
+        }
+
+        /* update m_portList */
+        m_portList[port.m_alias] = port;
     }
 
+    updateDbPortsOperSpeedAndFec(ports_up);
+
+    flushOperStatusBatch();
+}
+
+void PortsOrch::beginOperStatusBatch()
+{
+    m_operStatusBatch = true;
+}
+
+void PortsOrch::flushOperStatusBatch()
+{
+    SWSS_LOG_ENTER();
+
+    m_operStatusApplPipeline->flush();
+    m_operStatusStatePipeline->flush();
+    m_operStatusBatch = false;
 }
 
 void PortsOrch::updatePortOperStatus(Port &port, sai_port_oper_status_t status)
@@ -8158,28 +8241,115 @@ void PortsOrch::updatePortOperStatus(Port &port, sai_port_oper_status_t status)
     notify(SUBJECT_TYPE_PORT_OPER_STATE_CHANGE, static_cast<void *>(&update));
 }
 
-void PortsOrch::updateDbPortOperSpeed(Port &port, sai_uint32_t speed)
+/*
+ * Write the oper speed and FEC of the ports to STATE_DB. The attributes of all
+ * the ports are queried with a single bulk get when the SAI supports it, else
+ * with one get per port.
+ */
+void PortsOrch::updateDbPortsOperSpeedAndFec(const vector<Port> &ports)
 {
     SWSS_LOG_ENTER();
 
-    vector<FieldValueTuple> tuples;
-    string speedStr = speed != 0 ? to_string(speed) : "N/A";
-    tuples.emplace_back(std::make_pair("speed", speedStr));
-    m_portStateTable.set(port.m_alias, tuples);
+    if (ports.empty())
+    {
+        return;
+    }
 
-    // We don't set port.m_speed = speed here, because CONFIG_DB still hold the old
-    // value. If we set it here, next time configure any attributes related port will
-    // cause a port flapping.
-}
+    /* Oper speed, and oper FEC if supported */
+    const uint32_t attr_count = oper_fec_sup ? 2 : 1;
+    size_t count = ports.size();
 
-void PortsOrch::updateDbPortOperFec(Port &port, string fec_str)
-{
-    SWSS_LOG_ENTER();
+    vector<sai_object_id_t> port_ids(count);
+    vector<uint32_t> attr_counts(count, attr_count);
+    vector<sai_attribute_t> attrs(count * attr_count);
+    vector<sai_attribute_t *> attr_lists(count);
+    vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
 
-    vector<FieldValueTuple> tuples;
-    tuples.emplace_back(std::make_pair("fec", fec_str));
-    m_portStateTable.set(port.m_alias, tuples);
+    for (size_t i = 0; i < count; i++)
+    {
+        port_ids[i] = ports[i].m_port_id;
+        attr_lists[i] = &attrs[i * attr_count];
+        attr_lists[i][0].id = SAI_PORT_ATTR_OPER_SPEED;
+        if (oper_fec_sup)
+        {
+            attr_lists[i][1].id = SAI_PORT_ATTR_OPER_PORT_FEC_MODE;
+        }
+    }
 
+    if (m_bulkPortGetSupported && sai_port_api->get_ports_attribute != nullptr)
+    {
+        sai_status_t status = sai_port_api->get_ports_attribute(static_cast<uint32_t>(count), port_ids.data(),
+                attr_counts.data(), attr_lists.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+        {
+            SWSS_LOG_NOTICE("Bulk get of port attributes is not supported, querying ports one by one");
+            m_bulkPortGetSupported = false;
+            statuses.assign(count, SAI_STATUS_NOT_EXECUTED);
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const Port &port = ports[i];
+
+        if (port.m_type != Port::PHY)
+        {
+            continue;
+        }
+
+        if (statuses[i] == SAI_STATUS_NOT_EXECUTED)
+        {
+            statuses[i] = sai_port_api->get_port_attribute(port.m_port_id, attr_count, attr_lists[i]);
+        }
+
+        sai_uint32_t speed = 0;
+        sai_port_fec_mode_t fec_mode = SAI_PORT_FEC_MODE_NONE;
+        bool fec_valid = false;
+
+        if (statuses[i] == SAI_STATUS_SUCCESS)
+        {
+            speed = attr_lists[i][0].value.u32;
+            if (speed == 0)
+            {
+                SWSS_LOG_WARN("Port %s operational speed is 0", port.m_alias.c_str());
+            }
+            if (oper_fec_sup)
+            {
+                fec_mode = static_cast<sai_port_fec_mode_t>(attr_lists[i][1].value.s32);
+                fec_valid = true;
+            }
+        }
+        else
+        {
+            /* One of the attributes is not available, query them separately */
+            if (!getPortOperSpeed(port, speed))
+            {
+                speed = 0;
+            }
+            fec_valid = oper_fec_sup && getPortOperFec(port, fec_mode);
+        }
+
+        if (speed != 0)
+        {
+            SWSS_LOG_NOTICE("%s oper speed is %d", port.m_alias.c_str(), speed);
+        }
+
+        string fec_str = "N/A";
+        if (fec_valid && !m_portHlpr.fecToStr(fec_str, fec_mode))
+        {
+            SWSS_LOG_ERROR("Error unknown fec mode %d while querying port %s fec mode",
+                           static_cast<std::int32_t>(fec_mode), port.m_alias.c_str());
+            fec_str = "N/A";
+        }
+
+        // We don't set port.m_speed = speed here, because CONFIG_DB still hold the old
+        // value. If we set it here, next time configure any attributes related port will
+        // cause a port flapping.
+        vector<FieldValueTuple> tuples;
+        tuples.emplace_back("speed", speed != 0 ? to_string(speed) : "N/A");
+        tuples.emplace_back("fec", fec_str);
+        (m_operStatusBatch ? *m_operStatusPortStateTable : m_portStateTable).set(port.m_alias, tuples);
+    }
 }
 
 /*
@@ -8197,6 +8367,9 @@ void PortsOrch::refreshPortStatus()
 {
     SWSS_LOG_ENTER();
 
+    beginOperStatusBatch();
+
+    vector<Port> ports_up;
     for (auto &it: m_portList)
     {
         auto &port = it.second;
@@ -8208,6 +8381,7 @@ void PortsOrch::refreshPortStatus()
         sai_port_oper_status_t status;
         if (!getPortOperStatus(port, status))
         {
+            flushOperStatusBatch();
             throw runtime_error("PortsOrch get port oper status failure");
         }
 
@@ -8216,30 +8390,13 @@ void PortsOrch::refreshPortStatus()
 
         if (status == SAI_PORT_OPER_STATUS_UP)
         {
-            sai_uint32_t speed;
-            if (getPortOperSpeed(port, speed))
-            {
-                SWSS_LOG_INFO("%s oper speed is %d", port.m_alias.c_str(), speed);
-                updateDbPortOperSpeed(port, speed);
-            }
-            else
-            {
-                updateDbPortOperSpeed(port, 0);
-            }
-            sai_port_fec_mode_t fec_mode;
-            string fec_str = "N/A";
-            if (oper_fec_sup && getPortOperFec(port, fec_mode))
-            {
-                if (!m_portHlpr.fecToStr(fec_str, fec_mode))
-                {
-                    SWSS_LOG_ERROR("Error unknown fec mode %d while querying port %s fec mode",
-                                   static_cast<std::int32_t>(fec_mode), port.m_alias.c_str());
-                    fec_str = "N/A";
-                }
-            }
-            updateDbPortOperFec(port,fec_str);
+            ports_up.push_back(port);
         }
     }
+
+    updateDbPortsOperSpeedAndFec(ports_up);
+
+    flushOperStatusBatch();
 }
 
 bool PortsOrch::getPortOperStatus(const Port& port, sai_port_oper_status_t& status) const
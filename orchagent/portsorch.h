@@ -10,6 +10,7 @@
 #include "observer.h"
 #include "macaddress.h"
 #include "producertable.h"
+#include "redispipeline.h"
 #include "flex_counter_manager.h"
 #include "gearboxutils.h"
 #include "saihelper.h"
@@ -264,6 +265,17 @@ private:
     unique_ptr<Table> m_stateBufferMaximumValueTable;
     Table m_portStateTable;
 
+    /*
+     * The port oper status writes of a batch of notifications are queued on
+     * these pipelines and flushed once the whole batch is processed.
+     */
+    unique_ptr<RedisPipeline> m_operStatusApplPipeline;
+    unique_ptr<RedisPipeline> m_operStatusStatePipeline;
+    unique_ptr<Table> m_operStatusPortTable;
+    unique_ptr<Table> m_operStatusPortStateTable;
+    bool m_operStatusBatch = false;
+    bool m_bulkPortGetSupported = true;
+
     std::string getQueueWatermarkFlexCounterTableKey(std::string s);
     std::string getPriorityGroupWatermarkFlexCounterTableKey(std::string s);
     std::string getPriorityGroupDropPacketsFlexCounterTableKey(std::string s);
@@ -360,6 +372,9 @@ private:
 
     void doTask(NotificationConsumer &consumer);
     void doTask(swss::SelectableTimer &timer);
+    void doPortOperStatusTask(NotificationConsumer &consumer);
+    void beginOperStatusBatch();
+    void flushOperStatusBatch();
 
     void removePortFromLanesMap(string alias);
     void removePortFromPortListMap(sai_object_id_t port_id);
@@ -470,7 +485,7 @@ private:
     void updatePortOperStatus(Port &port, sai_port_oper_status_t status);
 
     bool getPortOperSpeed(const Port& port, sai_uint32_t& speed) const;
-    void updateDbPortOperSpeed(Port &port, sai_uint32_t speed);
+    void updateDbPortsOperSpeedAndFec(const vector<Port> &ports);
 
     bool getPortLinkTrainingRxStatus(const Port &port, sai_port_link_training_rx_status_t &rx_status);
     bool getPortLinkTrainingFailure(const Port &port, sai_port_link_training_failure_status_t &failure);
@@ -501,7 +516,6 @@ private:
     void initGearbox();
     bool initGearboxPort(Port &port);
     bool getPortOperFec(const Port& port, sai_port_fec_mode_t &fec_mode) const;
-    void updateDbPortOperFec(Port &port, string fec_str);
 
     map<string, Port::Role> m_recircPortRole;
 
@@ -0,0 +1,13 @@
+-- KEYS - keys of the table entries to read back at warm restart
+-- ARGV - None
+
+-- return the fields and values of each key, as HGETALL does,
+-- an empty list for a key which does not exist
+
+local entries = {}
+
+for i = 1, #KEYS do
+    entries[i] = redis.call('HGETALL', KEYS[i])
+end
+
+return entries
@@ -8,6 +8,9 @@
 namespace
 {
 
+// Maximum number of responses sent in one ZMQ message in buffered mode.
+constexpr size_t kZmqResponseBatchSize = 1000;
+
 // Returns the component string that we need to prepend for sending the error
 // message.
 // Returns an empty string if the status is OK.
@@ -102,19 +105,30 @@ void ResponsePublisher::publish(const std::string &table, const std::string &key
                                 const std::vector<swss::FieldValueTuple> &state_attrs, bool replace)
 {
     std::string response_channel = "APPL_DB_" + table + "_RESPONSE_CHANNEL";
-    swss::NotificationProducer notificationProducer{m_ntf_pipe.get(), response_channel, m_buffered};
 
     auto intent_attrs_copy = intent_attrs;
     // Add error message as the first field-value-pair.
     swss::FieldValueTuple err_str("err_str", PrependedComponent(status) + status.message());
     intent_attrs_copy.insert(intent_attrs_copy.begin(), err_str);
-    // Sends the response to the notification channel.
-    notificationProducer.send(status.codeStr(), key, intent_attrs_copy);
+    // Sends the response to the ZMQ client or to the notification channel.
+    if (m_zmqClient != nullptr)
+    {
+        sendZmqResponse(response_channel, swss::KeyOpFieldsValuesTuple{key, status.codeStr(), intent_attrs_copy});
+    }
+    else
+    {
+        swss::NotificationProducer notificationProducer{m_ntf_pipe.get(), response_channel, m_buffered};
+        notificationProducer.send(status.codeStr(), key, intent_attrs_copy);
+    }
     RecordResponse(response_channel, key, intent_attrs_copy, status.codeStr());
 
-    // Write to the DB only if:
+    // Write to the DB only if persisted and:
     // 1) A write operation is being performed and state attributes are specified.
     // 2) A successful delete operation.
+    if (!m_dbPersistence)
+    {
+        return;
+    }
     if ((intent_attrs.size() && state_attrs.size()) || (status.ok() && !intent_attrs.size()))
     {
         writeToDB(table, key, state_attrs, intent_attrs.size() ? SET_COMMAND : DEL_COMMAND, replace);
@@ -205,6 +219,10 @@ void ResponsePublisher::writeToDBInternal(const std::string &table, const std::s
 
 void ResponsePublisher::flush()
 {
+    if (m_zmqClient != nullptr)
+    {
+        flushZmqResponses();
+    }
     m_ntf_pipe->flush();
     if (m_update_thread != nullptr)
     {
@@ -226,6 +244,62 @@ void ResponsePublisher::setBuffered(bool buffered)
     m_buffered = buffered;
 }
 
+void ResponsePublisher::setZmqClient(swss::ZmqClient *zmqClient, bool dbPersistence)
+{
+    if (m_zmqClient != nullptr)
+    {
+        flushZmqResponses();
+    }
+    m_zmqTables.clear();
+
+    m_zmqClient = zmqClient;
+    m_dbPersistence = zmqClient == nullptr || dbPersistence;
+
+    // The controller gets the responses from ZMQ, so the DB writes are taken
+    // off the response path.
+    if (m_zmqClient != nullptr && m_dbPersistence && m_update_thread == nullptr)
+    {
+        m_update_thread = std::unique_ptr<std::thread>(new std::thread(&ResponsePublisher::dbUpdateThread, this));
+    }
+}
+
+void ResponsePublisher::sendZmqResponse(const std::string &response_channel,
+                                        const swss::KeyOpFieldsValuesTuple &response)
+{
+    auto &zmqTable = m_zmqTables[response_channel];
+    if (zmqTable == nullptr)
+    {
+        zmqTable = std::make_unique<swss::ZmqProducerStateTable>(m_db.get(), response_channel, *m_zmqClient,
+                                                                 /*dbPersistence=*/false);
+    }
+
+    if (!m_buffered)
+    {
+        zmqTable->send({response});
+        return;
+    }
+
+    auto &responses = m_zmqResponses[response_channel];
+    responses.push_back(response);
+    if (responses.size() >= kZmqResponseBatchSize)
+    {
+        zmqTable->send(responses);
+        responses.clear();
+    }
+}
+
+void ResponsePublisher::flushZmqResponses()
+{
+    for (auto &it : m_zmqResponses)
+    {
+        if (!it.second.empty())
+        {
+            m_zmqTables.at(it.first)->send(it.second);
+            it.second.clear();
+        }
+    }
+}
+
 void ResponsePublisher::dbUpdateThread()
 {
     while (true)
@@ -14,9 +14,12 @@
 #include "recorder.h"
 #include "response_publisher_interface.h"
 #include "table.h"
+#include "zmqclient.h"
+#include "zmqproducerstatetable.h"
 
 // This class performs two tasks when publish is called:
-// 1. Sends a notification into the redis channel.
+// 1. Sends a notification into the redis channel, or to the ZMQ client when
+//    one is set.
 // 2. Writes the operation into the DB.
 class ResponsePublisher : public ResponsePublisherInterface
 {
@@ -60,6 +63,19 @@ class ResponsePublisher : public ResponsePublisherInterface
      */
     void setBuffered(bool buffered);
 
+    /**
+     * @brief Send the responses to a ZMQ client instead of the redis channels
+     *
+     * The responses are sent in the ZMQ table named after the response
+     * channel, with the status code as operation. In buffered mode, the
+     * responses are sent in batches by flush().
+     *
+     * @param zmqClient ZMQ client connected to the controller, nullptr to use the redis channels
+     * @param dbPersistence Flag whether the state attributes are still written into the DB,
+     *                      they are written by the DB write thread
+     */
+    void setZmqClient(swss::ZmqClient *zmqClient, bool dbPersistence = true);
+
   private:
     struct entry
     {
@@ -83,6 +99,8 @@ class ResponsePublisher : public ResponsePublisherInterface
     };
 
     void dbUpdateThread();
+    void sendZmqResponse(const std::string &response_channel, const swss::KeyOpFieldsValuesTuple &response);
+    void flushZmqResponses();
     void writeToDBInternal(const std::string &table, const std::string &key,
                            const std::vector<swss::FieldValueTuple> &values, const std::string &op, bool replace);
 
@@ -96,4 +114,10 @@ class ResponsePublisher : public ResponsePublisherInterface
     std::queue<entry> m_queue;
     mutable std::mutex m_lock;
     std::condition_variable m_signal;
+
+    swss::ZmqClient *m_zmqClient{nullptr};
+    bool m_dbPersistence{true};
+    // ZMQ table of each response channel, and its responses waiting for flush().
+    std::unordered_map<std::string, std::unique_ptr<swss::ZmqProducerStateTable>> m_zmqTables;
+    std::unordered_map<std::string, std::vector<swss::KeyOpFieldsValuesTuple>> m_zmqResponses;
 };
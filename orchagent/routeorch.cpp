@@ -89,7 +89,6 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
     SWSS_LOG_NOTICE("Maximum number of ECMP groups supported is %d", m_maxNextHopGroupCount);
 
     m_stateDb = shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
-    m_stateDefaultRouteTb = unique_ptr<swss::Table>(new Table(m_stateDb.get(), STATE_ROUTE_TABLE_NAME));
 
     IpPrefix default_ip_prefix("0.0.0.0/0");
     updateDefRouteState("0.0.0.0/0");
@@ -113,7 +112,7 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
     gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
 
     /* Add default IPv4 route into the m_syncdRoutes */
-    m_syncdRoutes[gVirtualRouterId][default_ip_prefix] = RouteNhg();
+    m_syncdRoutes[gVirtualRouterId].set(default_ip_prefix, RouteNhg());
 
     SWSS_LOG_NOTICE("Create IPv4 default route with packet action drop");
 
@@ -133,7 +132,7 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
     gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
 
     /* Add default IPv6 route into the m_syncdRoutes */
-    m_syncdRoutes[gVirtualRouterId][v6_default_ip_prefix] = RouteNhg();
+    m_syncdRoutes[gVirtualRouterId].set(v6_default_ip_prefix, RouteNhg());
 
     SWSS_LOG_NOTICE("Create IPv6 default route with packet action drop");
 
@@ -254,7 +253,7 @@ void RouteOrch::updateDefRouteState(string ip, bool add)
     FieldValueTuple tuple("state", state);
     tuples.push_back(tuple);
 
-    m_stateDefaultRouteTb->set(ip, tuples);
+    m_stateWriter.set(m_stateDb.get(), STATE_ROUTE_TABLE_NAME, ip, tuples);
 }
 
 bool RouteOrch::hasNextHopGroup(const NextHopGroupKey& nexthops) const
@@ -268,6 +267,40 @@ sai_object_id_t RouteOrch::getNextHopGroupId(const NextHopGroupKey& nexthops)
     return m_syncdNextHopGroups[nexthops].next_hop_group_id;
 }
 
+/* Key of an observed address in the reverse index of the next hop observers */
+static ObservedAddress getObservedAddress(sai_object_id_t vrf_id, const IpAddress &addr)
+{
+    ip_addr_t ip = addr.getIp();
+    std::array<uint8_t, 16> bytes {};
+
+    if (ip.family == AF_INET)
+    {
+        memcpy(bytes.data(), &ip.ip_addr.ipv4_addr, sizeof(ip.ip_addr.ipv4_addr));
+    }
+    else
+    {
+        memcpy(bytes.data(), ip.ip_addr.ipv6_addr, sizeof(ip.ip_addr.ipv6_addr));
+    }
+
+    return std::make_tuple(vrf_id, static_cast<uint8_t>(ip.family), bytes);
+}
+
+/* First and last keys of the observed addresses covered by the prefix */
+static void getObservedAddressRange(sai_object_id_t vrf_id, const IpPrefix &prefix,
+                                    ObservedAddress &first, ObservedAddress &last)
+{
+    first = getObservedAddress(vrf_id, prefix.getIp());
+    last = first;
+
+    ObservedAddress mask = getObservedAddress(vrf_id, prefix.getMask());
+    size_t len = prefix.isV4() ? sizeof(uint32_t) : 16;
+    for (size_t i = 0; i < len; i++)
+    {
+        std::get<2>(first)[i] &= std::get<2>(mask)[i];
+        std::get<2>(last)[i] |= static_cast<uint8_t>(~std::get<2>(mask)[i]);
+    }
+}
+
 void RouteOrch::attach(Observer *observer, const IpAddress& dstAddr, sai_object_id_t vrf_id)
 {
     SWSS_LOG_ENTER();
@@ -283,19 +316,20 @@ void RouteOrch::attach(Observer *observer, const IpAddress& dstAddr, sai_object_
         observerEntry = m_nextHopObservers.find(host);
 
         /* Find the prefixes that cover the destination IP */
-        if (m_syncdRoutes.find(vrf_id) != m_syncdRoutes.end())
+        auto it_route_table = m_syncdRoutes.find(vrf_id);
+        if (it_route_table != m_syncdRoutes.end())
         {
-            for (auto route : m_syncdRoutes.at(vrf_id))
-            {
-                if (route.first.isAddressInSubnet(dstAddr))
-                {
-                    SWSS_LOG_INFO("Prefix %s covers destination address",
-                            route.first.to_string().c_str());
-                    observerEntry->second.routeTable.emplace(
-                            route.first, route.second);
-                }
-            }
+            auto &routeTable = observerEntry->second.routeTable;
+            it_route_table->second.forEachCoveringRoute(dstAddr,
+                    [&routeTable](const IpPrefix &prefix, const RouteNhg &nhg)
+                    {
+                        SWSS_LOG_INFO("Prefix %s covers destination address",
+                                prefix.to_string().c_str());
+                        routeTable.emplace(prefix, nhg);
+                    });
         }
+
+        m_observedAddresses.emplace(getObservedAddress(vrf_id, dstAddr), observerEntry);
     }
 
     observerEntry->second.observers.push_back(observer);
@@ -342,6 +376,7 @@ void RouteOrch::detach(Observer *observer, const IpAddress& dstAddr, sai_object_
             // destination IP.
             if (observerEntry->second.observers.empty())
             {
+                m_observedAddresses.erase(getObservedAddress(vrf_id, dstAddr));
                 m_nextHopObservers.erase(observerEntry);
             }
             break;
@@ -528,7 +563,7 @@ void RouteOrch::doTask(Consumer& consumer)
                 {
                     /* Mark all current routes as dirty (DEL) in consumer.m_toSync map */
                     SWSS_LOG_NOTICE("Start resync routes\n");
-                    for (auto j : m_syncdRoutes)
+                    for (const auto &j : m_syncdRoutes)
                     {
                         string vrf;
 
@@ -537,7 +572,7 @@ void RouteOrch::doTask(Consumer& consumer)
                             vrf = m_vrfOrch->getVRFname(j.first) + ":";
                         }
 
-                        for (auto i : j.second)
+                        for (const auto &i : j.second)
                         {
                             vector<FieldValueTuple> v;
                             key = vrf + i.first.to_string();
@@ -787,11 +822,18 @@ void RouteOrch::doTask(Consumer& consumer)
                             nhg_str += NH_DELIMITER + srv6_segv[i];
                             nhg_str += NH_DELIMITER + srv6_src[i];
                         }
-                        nhg = NextHopGroupKey(nhg_str, overlay_nh, srv6_nh);
+                        nhg = m_nhgKeyInterner.get(nhg_str, overlay_nh, srv6_nh);
                         SWSS_LOG_INFO("SRV6 route with nhg %s", nhg.to_string().c_str());
                     }
                     else if (overlay_nh == false)
                     {
+                        /*
+                         * Next hops without an alias or on a VRF are resolved
+                         * from the current router interfaces, so they can't be
+                         * served from the key interner.
+                         */
+                        bool resolved_alias = false;
+
                         for (uint32_t i = 0; i < ipv.size(); i++)
                         {
                             if (i) nhg_str += NHG_DELIMITER;
@@ -803,10 +845,21 @@ void RouteOrch::doTask(Consumer& consumer)
                             {
                                 nhg_str += mpls_nhv[i] + LABELSTACK_DELIMITER;
                             }
+                            if (alsv[i].empty() || !alsv[i].compare(0, strlen(VRF_PREFIX), VRF_PREFIX))
+                            {
+                                resolved_alias = true;
+                            }
                             nhg_str += ipv[i] + NH_DELIMITER + alsv[i];
                         }
 
-                        nhg = NextHopGroupKey(nhg_str, weights);
+                        if (resolved_alias)
+                        {
+                            nhg = NextHopGroupKey(nhg_str, weights);
+                        }
+                        else
+                        {
+                            nhg = m_nhgKeyInterner.get(nhg_str, weights);
+                        }
                     }
                     else
                     {
@@ -828,7 +881,7 @@ void RouteOrch::doTask(Consumer& consumer)
                             nhg_str += ipv[i] + NH_DELIMITER + "vni" + alsv[i] + NH_DELIMITER + vni_labelv[i] + NH_DELIMITER + rmacv[i];
                         }
 
-                        nhg = NextHopGroupKey(nhg_str, overlay_nh, srv6_nh);
+                        nhg = m_nhgKeyInterner.get(nhg_str, overlay_nh, srv6_nh);
                     }
                 }
                 else
@@ -897,7 +950,7 @@ void RouteOrch::doTask(Consumer& consumer)
                  * NhgOrch.
                  */
                 else if (m_syncdRoutes.find(vrf_id) == m_syncdRoutes.end() ||
-                    m_syncdRoutes.at(vrf_id).find(ip_prefix) == m_syncdRoutes.at(vrf_id).end() ||
+                    !m_syncdRoutes.at(vrf_id).contains(ip_prefix) ||
                     m_syncdRoutes.at(vrf_id).at(ip_prefix) != RouteNhg(nhg, ctx.nhg_index) ||
                     gRouteBulker.bulk_entry_pending_removal(route_entry) ||
                     ctx.using_temp_nhg)
@@ -992,7 +1045,7 @@ void RouteOrch::doTask(Consumer& consumer)
                         it_prev++;
                 }
                 else if (m_syncdRoutes.find(vrf_id) == m_syncdRoutes.end() ||
-                         m_syncdRoutes.at(vrf_id).find(ip_prefix) == m_syncdRoutes.at(vrf_id).end() ||
+                         !m_syncdRoutes.at(vrf_id).contains(ip_prefix) ||
                          m_syncdRoutes.at(vrf_id).at(ip_prefix) != RouteNhg(nhg, ctx.nhg_index) ||
                          ctx.using_temp_nhg)
                 {
@@ -1039,18 +1092,23 @@ void RouteOrch::doTask(Consumer& consumer)
             }
         }
     }
+
+    /* Release the interned keys of the removed routes */
+    m_nhgKeyInterner.purge();
 }
 
 void RouteOrch::notifyNextHopChangeObservers(sai_object_id_t vrf_id, const IpPrefix &prefix, const NextHopGroupKey &nexthops, bool add)
 {
     SWSS_LOG_ENTER();
 
-    for (auto& entry : m_nextHopObservers)
+    /* Only the observed addresses covered by the prefix are visited */
+    ObservedAddress first, last;
+    getObservedAddressRange(vrf_id, prefix, first, last);
+
+    auto it_end = m_observedAddresses.upper_bound(last);
+    for (auto it = m_observedAddresses.lower_bound(first); it != it_end; ++it)
     {
-        if (vrf_id != entry.first.first || !prefix.isAddressInSubnet(entry.first.second))
-        {
-            continue;
-        }
+        auto& entry = *it->second;
 
         if (add)
         {
@@ -1181,14 +1239,24 @@ const NextHopGroupKey RouteOrch::getSyncdRouteNhgKey(sai_object_id_t vrf_id, con
     if (route_table != m_syncdRoutes.end())
     {
         auto route_entry = route_table->second.find(ipPrefix);
-        if (route_entry != route_table->second.end())
+        if (route_entry != nullptr)
         {
-            nhg = route_entry->second.nhg_key;
+            nhg = route_entry->nhg_key;
         }
     }
     return nhg;
 }
 
+size_t RouteOrch::getSyncdRoutesMemoryUsage() const
+{
+    size_t usage = 0;
+    for (const auto &route_table : m_syncdRoutes)
+    {
+        usage += route_table.second.getMemoryUsage();
+    }
+    return usage;
+}
+
 bool RouteOrch::createFineGrainedNextHopGroup(sai_object_id_t &next_hop_group_id, vector<sai_attribute_t> &nhg_attrs)
 {
     SWSS_LOG_ENTER();
@@ -1901,9 +1969,9 @@ bool RouteOrch::addRoute(RouteBulkContext& ctx, const NextHopGroupKey &nextHops)
 
                 /* If the current next hop is part of the next hop group to sync,
                  * then return false and no need to add another temporary route. */
-                if (it_route != m_syncdRoutes.at(vrf_id).end() && it_route->second.nhg_key.getSize() == 1)
+                if (it_route != nullptr && it_route->nhg_key.getSize() == 1)
                 {
-                    const NextHopKey& nexthop = *it_route->second.nhg_key.getNextHops().begin();
+                    const NextHopKey& nexthop = *it_route->nhg_key.getNextHops().begin();
                     if (nextHops.contains(nexthop))
                     {
                         return false;
@@ -1941,7 +2009,7 @@ bool RouteOrch::addRoute(RouteBulkContext& ctx, const NextHopGroupKey &nextHops)
      * from m_syncdRoutes during the bulk call. Therefore, such entries need to be
      * re-created rather than set attribute.
      */
-    if (it_route == m_syncdRoutes.at(vrf_id).end() || gRouteBulker.bulk_entry_pending_removal(route_entry))
+    if (it_route == nullptr || gRouteBulker.bulk_entry_pending_removal(route_entry))
     {
         if (blackhole)
         {
@@ -1967,7 +2035,7 @@ bool RouteOrch::addRoute(RouteBulkContext& ctx, const NextHopGroupKey &nextHops)
     else
     {
         /* Set the packet action to forward when there was no next hop (dropped) and not pointing to blackhole*/
-        if (it_route->second.nhg_key.getSize() == 0 && !blackhole)
+        if (it_route->nhg_key.getSize() == 0 && !blackhole)
         {
             route_attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
             route_attr.value.s32 = SAI_PACKET_ACTION_FORWARD;
@@ -2102,7 +2170,7 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
     MuxOrch* mux_orch = gDirectory.get<MuxOrch*>();
     if (isFineGrained)
     {
-        if (it_route == m_syncdRoutes.at(vrf_id).end())
+        if (it_route == nullptr)
         {
             /* First time route addition pointing to FG nhg */
             if (*it_status++ != SAI_STATUS_SUCCESS)
@@ -2128,23 +2196,23 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
         else
         {
             /* Route already exists */
-            auto nh_entry = m_syncdNextHopGroups.find(it_route->second.nhg_key);
+            auto nh_entry = m_syncdNextHopGroups.find(it_route->nhg_key);
             if (nh_entry != m_syncdNextHopGroups.end())
             {
                 /* Case where route was pointing to non-fine grained nhs in the past,
                  * and transitioned to Fine Grained ECMP */
-                decreaseNextHopRefCount(it_route->second.nhg_key);
-                if (it_route->second.nhg_key.getSize() > 1
-                    && m_syncdNextHopGroups[it_route->second.nhg_key].ref_count == 0)
+                decreaseNextHopRefCount(it_route->nhg_key);
+                if (it_route->nhg_key.getSize() > 1
+                    && m_syncdNextHopGroups[it_route->nhg_key].ref_count == 0)
                 {
-                    m_bulkNhgReducedRefCnt.emplace(it_route->second.nhg_key, 0);
+                    m_bulkNhgReducedRefCnt.emplace(it_route->nhg_key, 0);
                 }
             }
             SWSS_LOG_INFO("FG Post set route %s with next hop(s) %s",
                     ipPrefix.to_string().c_str(), nextHops.to_string().c_str());
         }
     }
-    else if (it_route == m_syncdRoutes.at(vrf_id).end())
+    else if (it_route == nullptr)
     {
         sai_status_t status = *it_status++;
         if (status != SAI_STATUS_SUCCESS)
@@ -2192,7 +2260,7 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
         sai_status_t status;
 
         /* Set the packet action to forward when there was no next hop (dropped) and not pointing to blackhole */
-        if (it_route->second.nhg_key.getSize() == 0 && !blackhole)
+        if (it_route->nhg_key.getSize() == 0 && !blackhole)
         {
             status = *it_status++;
             if (status != SAI_STATUS_SUCCESS)
@@ -2225,10 +2293,10 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
             m_fgNhgOrch->removeFgNhg(vrf_id, ipPrefix);
         }
         /* Decrease the ref count for the previous next hop group. */
-        else if (it_route->second.nhg_index.empty())
+        else if (it_route->nhg_index.empty())
         {
-            decreaseNextHopRefCount(it_route->second.nhg_key);
-            auto ol_nextHops = it_route->second.nhg_key;
+            decreaseNextHopRefCount(it_route->nhg_key);
+            auto ol_nextHops = it_route->nhg_key;
             if (ol_nextHops.getSize() > 1)
             {
                 if (m_syncdNextHopGroups[ol_nextHops].ref_count == 0)
@@ -2252,7 +2320,7 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
             }
             else if (ol_nextHops.is_overlay_nexthop())
             {
-                const NextHopKey& nexthop = *it_route->second.nhg_key.getNextHops().begin();
+                const NextHopKey& nexthop = *it_route->nhg_key.getNextHops().begin();
                 if (m_neighOrch->getNextHopRefCount(nexthop) == 0)
                 {
                     SWSS_LOG_NOTICE("Update overlay Nexthop %s", ol_nextHops.to_string().c_str());
@@ -2273,7 +2341,7 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
         /* The next hop group is owned by (Cbf)NhgOrch. */
         else
         {
-            decNhgRefCount(it_route->second.nhg_index);
+            decNhgRefCount(it_route->nhg_index);
         }
 
         if (blackhole)
@@ -2333,12 +2401,12 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
         updateDefRouteState(ipPrefix.to_string(), true);
     }
 
-    if (it_route == m_syncdRoutes.at(vrf_id).end())
+    if (it_route == nullptr)
     {
         gFlowCounterRouteOrch->handleRouteAdd(vrf_id, ipPrefix);
     }
 
-    m_syncdRoutes[vrf_id][ipPrefix] = RouteNhg(nextHops, ctx.nhg_index);
+    m_syncdRoutes[vrf_id].set(ipPrefix, RouteNhg(nextHops, ctx.nhg_index));
 
     /* add subnet decap term for VIP route */
     const SubnetDecapConfig &config = gTunneldecapOrch->getSubnetDecapConfig();
@@ -2387,7 +2455,7 @@ bool RouteOrch::removeRoute(RouteBulkContext& ctx)
 
     auto it_route = it_route_table->second.find(ipPrefix);
     size_t creating = gRouteBulker.creating_entries_count(route_entry);
-    if (it_route == it_route_table->second.end() && creating == 0)
+    if (it_route == nullptr && creating == 0)
     {
         SWSS_LOG_INFO("Failed to find route entry, vrf_id 0x%" PRIx64 ", prefix %s\n", vrf_id,
                 ipPrefix.to_string().c_str());
@@ -2502,9 +2570,9 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
         m_fgNhgOrch->removeFgNhg(vrf_id, ipPrefix);
     }
     /* Check if the next hop group is not owned by NhgOrch. */
-    else if (!it_route->second.nhg_index.empty())
+    else if (!it_route->nhg_index.empty())
     {
-        decNhgRefCount(it_route->second.nhg_index);
+        decNhgRefCount(it_route->nhg_index);
     }
     /* The NHG is owned by RouteOrch */
     else
@@ -2512,16 +2580,16 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
         /*
          * Decrease the reference count only when the route is pointing to a next hop.
          */
-        decreaseNextHopRefCount(it_route->second.nhg_key);
+        decreaseNextHopRefCount(it_route->nhg_key);
 
-        auto ol_nextHops = it_route->second.nhg_key;
+        auto ol_nextHops = it_route->nhg_key;
         MuxOrch* mux_orch = gDirectory.get<MuxOrch*>();
-        if (it_route->second.nhg_key.getSize() > 1)
+        if (it_route->nhg_key.getSize() > 1)
         {
-            if (m_syncdNextHopGroups[it_route->second.nhg_key].ref_count == 0)
+            if (m_syncdNextHopGroups[it_route->nhg_key].ref_count == 0)
             {
                 SWSS_LOG_NOTICE("Remove Nexthop Group %s", ol_nextHops.to_string().c_str());
-                m_bulkNhgReducedRefCnt.emplace(it_route->second.nhg_key, 0);
+                m_bulkNhgReducedRefCnt.emplace(it_route->nhg_key, 0);
             }
             if (mux_orch->isMuxNexthops(ol_nextHops))
             {
@@ -2541,7 +2609,7 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
         }
         else if (ol_nextHops.is_overlay_nexthop())
         {
-            const NextHopKey& nexthop = *it_route->second.nhg_key.getNextHops().begin();
+            const NextHopKey& nexthop = *it_route->nhg_key.getNextHops().begin();
             if (m_neighOrch->getNextHopRefCount(nexthop) == 0)
             {
                 SWSS_LOG_NOTICE("Remove overlay Nexthop %s", ol_nextHops.to_string().c_str());
@@ -2552,9 +2620,9 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
          * Additionally check if the NH has label and its ref count == 0, then
          * remove the label next hop.
          */
-        else if (it_route->second.nhg_key.getSize() == 1)
+        else if (it_route->nhg_key.getSize() == 1)
         {
-            const NextHopKey& nexthop = *it_route->second.nhg_key.getNextHops().begin();
+            const NextHopKey& nexthop = *it_route->nhg_key.getNextHops().begin();
             if (nexthop.isMplsNextHop() &&
                 (m_neighOrch->getNextHopRefCount(nexthop) == 0))
             {
@@ -2563,7 +2631,7 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
             else if (nexthop.isSrv6NextHop() &&
                     (m_neighOrch->getNextHopRefCount(nexthop) == 0))
             {
-                m_srv6Orch->removeSrv6Nexthops(it_route->second.nhg_key);
+                m_srv6Orch->removeSrv6Nexthops(it_route->nhg_key);
             }
 
             RouteKey r_key = { vrf_id, ipPrefix };
@@ -2572,7 +2640,7 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
     }
 
     SWSS_LOG_INFO("Remove route %s with next hop(s) %s",
-            ipPrefix.to_string().c_str(), it_route->second.nhg_key.to_string().c_str());
+            ipPrefix.to_string().c_str(), it_route->nhg_key.to_string().c_str());
 
     /* Publish removal status, removes route entry from APPL STATE DB */
     publishRouteState(ctx);
@@ -2583,10 +2651,10 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
 
     if (ipPrefix.isDefaultRoute() && vrf_id == gVirtualRouterId)
     {
-        it_route_table->second[ipPrefix] = RouteNhg();
+        it_route_table->second.set(ipPrefix, RouteNhg());
 
         /* Notify about default route next hop change */
-        notifyNextHopChangeObservers(vrf_id, ipPrefix, it_route_table->second[ipPrefix].nhg_key, true);
+        notifyNextHopChangeObservers(vrf_id, ipPrefix, it_route_table->second.at(ipPrefix).nhg_key, true);
     }
     else
     {
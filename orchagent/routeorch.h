@@ -13,9 +13,12 @@
 #include "ipaddresses.h"
 #include "ipprefix.h"
 #include "nexthopgroupkey.h"
+#include "routetable.h"
 #include "bulker.h"
 #include "fgnhgorch.h"
+#include <array>
 #include <map>
+#include <tuple>
 
 /* Maximum next hop group number */
 #define NHGRP_MAX_SIZE 128
@@ -50,30 +53,6 @@ struct NextHopUpdate
     NextHopGroupKey nexthopGroup;
 };
 
-/*
- * Structure describing the next hop group used by a route.  As the next hop
- * groups can either be owned by RouteOrch or by NhgOrch, we have to keep track
- * of the next hop group index, as it is the one telling us which one owns it.
- */
-struct RouteNhg
-{
-    NextHopGroupKey nhg_key;
-
-    /*
-     * Index of the next hop group used.  Filled only if referencing a
-     * NhgOrch's owned next hop group.
-     */
-    std::string nhg_index;
-
-    RouteNhg() = default;
-    RouteNhg(const NextHopGroupKey& key, const std::string& index) :
-        nhg_key(key), nhg_index(index) {}
-
-    bool operator==(const RouteNhg& rnhg)
-       { return ((nhg_key == rnhg.nhg_key) && (nhg_index == rnhg.nhg_index)); }
-    bool operator!=(const RouteNhg& rnhg) { return !(*this == rnhg); }
-};
-
 struct NextHopObserverEntry;
 
 /* Route destination key for a nexthop */
@@ -90,8 +69,6 @@ struct RouteKey
 
 /* NextHopGroupTable: NextHopGroupKey, NextHopGroupEntry */
 typedef std::map<NextHopGroupKey, NextHopGroupEntry> NextHopGroupTable;
-/* RouteTable: destination network, NextHopGroupKey */
-typedef std::map<IpPrefix, RouteNhg> RouteTable;
 /* RouteTables: vrf_id, RouteTable */
 typedef std::map<sai_object_id_t, RouteTable> RouteTables;
 /* LabelRouteTable: destination label, next hop address(es) */
@@ -105,12 +82,23 @@ typedef std::map<Host, NextHopObserverEntry> NextHopObserverTable;
 /* Single Nexthop to Routemap */
 typedef std::map<NextHopKey, std::set<RouteKey>> NextHopRouteTable;
 
+/* ObservedRouteTable: destination network covering an observed address, NextHopGroupKey */
+typedef std::map<IpPrefix, RouteNhg> ObservedRouteTable;
+
 struct NextHopObserverEntry
 {
-    RouteTable routeTable;
+    ObservedRouteTable routeTable;
     list<Observer *> observers;
 };
 
+/* ObservedAddress: vrf_id, address family, address in network byte order */
+typedef std::tuple<sai_object_id_t, uint8_t, std::array<uint8_t, 16>> ObservedAddress;
+/*
+ * ObservedAddressIndex: observed address, next hop observer entry. The
+ * addresses covered by a prefix are a contiguous range of the index.
+ */
+typedef std::map<ObservedAddress, NextHopObserverTable::iterator> ObservedAddressIndex;
+
 struct RouteBulkContext
 {
     std::deque<sai_status_t>            object_statuses;    // Bulk statuses
@@ -227,6 +215,9 @@ public:
     void decreaseNextHopGroupCount();
     bool checkNextHopGroupCount();
     const RouteTables& getSyncdRoutes() const { return m_syncdRoutes; }
+    size_t getSyncdRoutesMemoryUsage() const;
+
+    NextHopGroupKey internNextHopGroupKey(const NextHopGroupKey &key) { return m_nhgKeyInterner.intern(key); }
 
 private:
     SwitchOrch *m_switchOrch;
@@ -241,12 +232,12 @@ private:
     bool m_resync;
 
     shared_ptr<DBConnector> m_stateDb;
-    unique_ptr<swss::Table> m_stateDefaultRouteTb;
 
     RouteTables m_syncdRoutes;
     LabelRouteTables m_syncdLabelRoutes;
     NextHopGroupTable m_syncdNextHopGroups;
     NextHopRouteTable m_nextHops;
+    NextHopGroupKeyInterner m_nhgKeyInterner;
 
     std::set<std::pair<NextHopGroupKey, sai_object_id_t>> m_bulkNhgReducedRefCnt;
     /* m_bulkNhgReducedRefCnt: nexthop, vrf_id */
@@ -255,6 +246,7 @@ private:
     ProducerStateTable m_appTunnelDecapTermProducer;
 
     NextHopObserverTable m_nextHopObservers;
+    ObservedAddressIndex m_observedAddresses;
 
     EntityBulker<sai_route_api_t>           gRouteBulker;
     EntityBulker<sai_mpls_api_t>            gLabelRouteBulker;
@@ -0,0 +1,634 @@
+#ifndef SWSS_ROUTETABLE_H
+#define SWSS_ROUTETABLE_H
+
+#include <arpa/inet.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ipaddress.h"
+#include "ipprefix.h"
+#include "nexthopgroupkey.h"
+
+/*
+ * Structure describing the next hop group used by a route.  As the next hop
+ * groups can either be owned by RouteOrch or by NhgOrch, we have to keep track
+ * of the next hop group index, as it is the one telling us which one owns it.
+ */
+struct RouteNhg
+{
+    NextHopGroupKey nhg_key;
+
+    /*
+     * Index of the next hop group used.  Filled only if referencing a
+     * NhgOrch's owned next hop group.
+     */
+    std::string nhg_index;
+
+    RouteNhg() = default;
+    RouteNhg(const NextHopGroupKey& key, const std::string& index) :
+        nhg_key(key), nhg_index(index) {}
+
+    bool operator==(const RouteNhg& rnhg) const
+       { return ((nhg_key == rnhg.nhg_key) && (nhg_index == rnhg.nhg_index)); }
+    bool operator!=(const RouteNhg& rnhg) const { return !(*this == rnhg); }
+    bool operator<(const RouteNhg& rnhg) const
+       { return std::tie(nhg_key, nhg_index) < std::tie(rnhg.nhg_key, rnhg.nhg_index); }
+};
+
+struct PackedIpv4Prefix
+{
+    uint32_t addr;
+    uint8_t len;
+
+    bool operator==(const PackedIpv4Prefix &o) const
+    {
+        return addr == o.addr && len == o.len;
+    }
+};
+
+struct PackedIpv6Prefix
+{
+    uint8_t addr[16];
+    uint8_t len;
+
+    bool operator==(const PackedIpv6Prefix &o) const
+    {
+        return len == o.len && memcmp(addr, o.addr, sizeof(addr)) == 0;
+    }
+};
+
+inline size_t hashPackedValue(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
+}
+
+struct PackedIpv4PrefixHash
+{
+    size_t operator()(const PackedIpv4Prefix &key) const
+    {
+        return hashPackedValue((static_cast<uint64_t>(key.addr) << 8) | key.len);
+    }
+};
+
+struct PackedIpv6PrefixHash
+{
+    size_t operator()(const PackedIpv6Prefix &key) const
+    {
+        uint64_t hi, lo;
+        memcpy(&hi, key.addr, sizeof(hi));
+        memcpy(&lo, key.addr + sizeof(hi), sizeof(lo));
+        return hashPackedValue(hi ^ hashPackedValue(lo ^ key.len));
+    }
+};
+
+/*
+ * Open addressing hash table with linear probing, mapping packed prefixes to
+ * a 32 bit value. Removal shifts back the following entries of the probe
+ * sequence, so the table never holds tombstones.
+ */
+template <typename Key, typename Hash>
+class PackedPrefixMap
+{
+public:
+    static const uint32_t EMPTY = UINT32_MAX;
+
+    struct Slot
+    {
+        Key key;
+        uint32_t value;
+    };
+
+    const Slot *find(const Key &key) const
+    {
+        if (m_slots.empty())
+        {
+            return nullptr;
+        }
+
+        for (size_t i = Hash()(key) & mask();; i = (i + 1) & mask())
+        {
+            const Slot &slot = m_slots[i];
+            if (slot.value == EMPTY)
+            {
+                return nullptr;
+            }
+            if (slot.key == key)
+            {
+                return &slot;
+            }
+        }
+    }
+
+    Slot *find(const Key &key)
+    {
+        return const_cast<Slot *>(static_cast<const PackedPrefixMap *>(this)->find(key));
+    }
+
+    /* Insert a key which is not in the map yet */
+    void insert(const Key &key, uint32_t value)
+    {
+        if ((m_size + 1) * 4 > m_slots.size() * 3)
+        {
+            rehash(m_slots.empty() ? MIN_CAPACITY : m_slots.size() * 2);
+        }
+
+        size_t i = Hash()(key) & mask();
+        while (m_slots[i].value != EMPTY)
+        {
+            i = (i + 1) & mask();
+        }
+
+        m_slots[i].key = key;
+        m_slots[i].value = value;
+        m_size++;
+    }
+
+    void erase(Slot *slot)
+    {
+        size_t i = static_cast<size_t>(slot - m_slots.data());
+        size_t j = i;
+
+        while (true)
+        {
+            j = (j + 1) & mask();
+            if (m_slots[j].value == EMPTY)
+            {
+                break;
+            }
+
+            /* Keep the entry in place if its home slot is cyclically in (i, j] */
+            size_t home = Hash()(m_slots[j].key) & mask();
+            if (i <= j ? (i < home && home <= j) : (i < home || home <= j))
+            {
+                continue;
+            }
+
+            m_slots[i] = m_slots[j];
+            i = j;
+        }
+
+        m_slots[i].value = EMPTY;
+        m_size--;
+
+        if (m_size == 0)
+        {
+            std::vector<Slot>().swap(m_slots);
+        }
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    size_t capacity() const
+    {
+        return m_slots.size();
+    }
+
+    const Slot &slotAt(size_t i) const
+    {
+        return m_slots[i];
+    }
+
+private:
+    static const size_t MIN_CAPACITY = 16;
+
+    std::vector<Slot> m_slots;
+    size_t m_size = 0;
+
+    size_t mask() const
+    {
+        return m_slots.size() - 1;
+    }
+
+    void rehash(size_t capacity)
+    {
+        std::vector<Slot> slots(capacity);
+        for (auto &slot : slots)
+        {
+            slot.value = EMPTY;
+        }
+
+        slots.swap(m_slots);
+        m_size = 0;
+
+        for (const auto &slot : slots)
+        {
+            if (slot.value != EMPTY)
+            {
+                insert(slot.key, slot.value);
+            }
+        }
+    }
+};
+
+template <typename Key, typename Hash>
+const uint32_t PackedPrefixMap<Key, Hash>::EMPTY;
+
+template <typename Key, typename Hash>
+const size_t PackedPrefixMap<Key, Hash>::MIN_CAPACITY;
+
+/*
+ * Compact per VRF route table. The prefixes are packed into the keys of open
+ * addressing hash tables, one per address family, and the RouteNhg of the
+ * routes are stored once per distinct value and referenced by index. At full
+ * table size a route costs a few bytes of hash table slot instead of a
+ * std::map node holding the prefix, the next hop group key and the index.
+ *
+ * The number of routes of each prefix length is tracked as well, so that the
+ * routes covering an address are found with one lookup per prefix length in
+ * use instead of a walk over the whole table.
+ */
+class RouteTable
+{
+public:
+    typedef std::pair<IpPrefix, const RouteNhg &> value_type;
+
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef RouteTable::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type *pointer;
+        typedef value_type reference;
+
+        const_iterator(const RouteTable *table, size_t pos) :
+            m_table(table), m_pos(pos)
+        {
+            skipEmpty();
+        }
+
+        value_type operator*() const
+        {
+            return m_table->entryAt(m_pos);
+        }
+
+        const_iterator &operator++()
+        {
+            m_pos++;
+            skipEmpty();
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator it = *this;
+            ++(*this);
+            return it;
+        }
+
+        bool operator==(const const_iterator &o) const
+        {
+            return m_table == o.m_table && m_pos == o.m_pos;
+        }
+
+        bool operator!=(const const_iterator &o) const
+        {
+            return !(*this == o);
+        }
+
+    private:
+        const RouteTable *m_table;
+        size_t m_pos;
+
+        void skipEmpty()
+        {
+            while (m_pos < m_table->slotCount() && !m_table->isOccupied(m_pos))
+            {
+                m_pos++;
+            }
+        }
+    };
+
+    /* Return the next hop group of the route, or nullptr if the route doesn't exist */
+    const RouteNhg *find(const IpPrefix &prefix) const
+    {
+        uint32_t index = findIndex(prefix);
+        return index == Ipv4Map::EMPTY ? nullptr : &m_nhgs[index];
+    }
+
+    const RouteNhg &at(const IpPrefix &prefix) const
+    {
+        const RouteNhg *nhg = find(prefix);
+        if (nhg == nullptr)
+        {
+            throw std::out_of_range("Route " + prefix.to_string() + " not found");
+        }
+        return *nhg;
+    }
+
+    bool contains(const IpPrefix &prefix) const
+    {
+        return findIndex(prefix) != Ipv4Map::EMPTY;
+    }
+
+    /* Add the route or replace its next hop group */
+    void set(const IpPrefix &prefix, const RouteNhg &nhg)
+    {
+        uint32_t index = acquire(nhg);
+        auto ip = prefix.getIp().getIp();
+
+        if (ip.family == AF_INET)
+        {
+            PackedIpv4Prefix key = packIpv4(ip, prefix.getMaskLength());
+            auto slot = m_v4Routes.find(key);
+            if (slot != nullptr)
+            {
+                release(slot->value);
+                slot->value = index;
+            }
+            else
+            {
+                m_v4Routes.insert(key, index);
+                m_v4Lengths[key.len]++;
+            }
+        }
+        else
+        {
+            PackedIpv6Prefix key = packIpv6(ip, prefix.getMaskLength());
+            auto slot = m_v6Routes.find(key);
+            if (slot != nullptr)
+            {
+                release(slot->value);
+                slot->value = index;
+            }
+            else
+            {
+                m_v6Routes.insert(key, index);
+                m_v6Lengths[key.len]++;
+            }
+        }
+    }
+
+    /* Remove the route. Returns false if the route doesn't exist */
+    bool erase(const IpPrefix &prefix)
+    {
+        auto ip = prefix.getIp().getIp();
+
+        if (ip.family == AF_INET)
+        {
+            auto slot = m_v4Routes.find(packIpv4(ip, prefix.getMaskLength()));
+            if (slot == nullptr)
+            {
+                return false;
+            }
+            release(slot->value);
+            m_v4Lengths[slot->key.len]--;
+            m_v4Routes.erase(slot);
+        }
+        else
+        {
+            auto slot = m_v6Routes.find(packIpv6(ip, prefix.getMaskLength()));
+            if (slot == nullptr)
+            {
+                return false;
+            }
+            release(slot->value);
+            m_v6Lengths[slot->key.len]--;
+            m_v6Routes.erase(slot);
+        }
+
+        return true;
+    }
+
+    /*
+     * Call visit(prefix, nhg) for each route covering the address, from the
+     * shortest to the longest prefix. The last visited route is the longest
+     * prefix match of the address.
+     */
+    template <typename Visitor>
+    void forEachCoveringRoute(const IpAddress &addr, Visitor visit) const
+    {
+        ip_addr_t subnet = addr.getIp();
+
+        if (subnet.family == AF_INET)
+        {
+            uint32_t host = ntohl(subnet.ip_addr.ipv4_addr);
+
+            for (int len = 0; len <= 32; len++)
+            {
+                if (m_v4Lengths[len] == 0)
+                {
+                    continue;
+                }
+
+                uint32_t mask = len == 0 ? 0 : ~0u << (32 - len);
+                subnet.ip_addr.ipv4_addr = htonl(host & mask);
+
+                auto slot = m_v4Routes.find(packIpv4(subnet, len));
+                if (slot != nullptr)
+                {
+                    visit(IpPrefix(subnet, len), m_nhgs[slot->value]);
+                }
+            }
+        }
+        else
+        {
+            const ip_addr_t host = subnet;
+
+            for (int len = 0; len <= 128; len++)
+            {
+                if (m_v6Lengths[len] == 0)
+                {
+                    continue;
+                }
+
+                for (int i = 0; i < 16; i++)
+                {
+                    int bits = std::min(std::max(len - i * 8, 0), 8);
+                    uint8_t mask = static_cast<uint8_t>(0xff00 >> bits);
+                    subnet.ip_addr.ipv6_addr[i] = host.ip_addr.ipv6_addr[i] & mask;
+                }
+
+                auto slot = m_v6Routes.find(packIpv6(subnet, len));
+                if (slot != nullptr)
+                {
+                    visit(IpPrefix(subnet, len), m_nhgs[slot->value]);
+                }
+            }
+        }
+    }
+
+    size_t size() const
+    {
+        return m_v4Routes.size() + m_v6Routes.size();
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /* Number of distinct next hop groups referenced by the routes */
+    size_t nhgCount() const
+    {
+        return m_nhgIndexes.size();
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, slotCount());
+    }
+
+    /*
+     * Approximate number of bytes used by the table, excluding the next hop
+     * sets which are shared with the next hop group keys of the other orchs.
+     */
+    size_t getMemoryUsage() const
+    {
+        /* Red-black tree node header of the next hop group index */
+        const size_t map_node_overhead = 4 * sizeof(void *);
+
+        return sizeof(*this) +
+               m_v4Routes.capacity() * sizeof(Ipv4Map::Slot) +
+               m_v6Routes.capacity() * sizeof(Ipv6Map::Slot) +
+               m_nhgs.size() * sizeof(RouteNhg) +
+               m_nhgRefCounts.capacity() * sizeof(uint32_t) +
+               m_freeNhgs.capacity() * sizeof(uint32_t) +
+               m_nhgIndexes.size() * (map_node_overhead + sizeof(std::pair<const RouteNhg, uint32_t>));
+    }
+
+private:
+    typedef PackedPrefixMap<PackedIpv4Prefix, PackedIpv4PrefixHash> Ipv4Map;
+    typedef PackedPrefixMap<PackedIpv6Prefix, PackedIpv6PrefixHash> Ipv6Map;
+
+    Ipv4Map m_v4Routes;
+    Ipv6Map m_v6Routes;
+
+    /* Number of routes per prefix length */
+    std::array<uint32_t, 33> m_v4Lengths {};
+    std::array<uint32_t, 129> m_v6Lengths {};
+
+    /* Next hop groups of the routes, indexed by the values of the route maps */
+    std::deque<RouteNhg> m_nhgs;
+    std::vector<uint32_t> m_nhgRefCounts;
+    std::vector<uint32_t> m_freeNhgs;
+    std::map<RouteNhg, uint32_t> m_nhgIndexes;
+
+    static PackedIpv4Prefix packIpv4(const ip_addr_t &ip, int len)
+    {
+        PackedIpv4Prefix key;
+        key.addr = ip.ip_addr.ipv4_addr;
+        key.len = static_cast<uint8_t>(len);
+        return key;
+    }
+
+    static PackedIpv6Prefix packIpv6(const ip_addr_t &ip, int len)
+    {
+        PackedIpv6Prefix key;
+        memcpy(key.addr, ip.ip_addr.ipv6_addr, sizeof(key.addr));
+        key.len = static_cast<uint8_t>(len);
+        return key;
+    }
+
+    uint32_t findIndex(const IpPrefix &prefix) const
+    {
+        auto ip = prefix.getIp().getIp();
+
+        if (ip.family == AF_INET)
+        {
+            auto slot = m_v4Routes.find(packIpv4(ip, prefix.getMaskLength()));
+            return slot == nullptr ? Ipv4Map::EMPTY : slot->value;
+        }
+
+        auto slot = m_v6Routes.find(packIpv6(ip, prefix.getMaskLength()));
+        return slot == nullptr ? Ipv6Map::EMPTY : slot->value;
+    }
+
+    uint32_t acquire(const RouteNhg &nhg)
+    {
+        auto it = m_nhgIndexes.find(nhg);
+        if (it != m_nhgIndexes.end())
+        {
+            m_nhgRefCounts[it->second]++;
+            return it->second;
+        }
+
+        uint32_t index;
+        if (!m_freeNhgs.empty())
+        {
+            index = m_freeNhgs.back();
+            m_freeNhgs.pop_back();
+            m_nhgs[index] = nhg;
+            m_nhgRefCounts[index] = 1;
+        }
+        else
+        {
+            index = static_cast<uint32_t>(m_nhgs.size());
+            m_nhgs.push_back(nhg);
+            m_nhgRefCounts.push_back(1);
+        }
+
+        m_nhgIndexes.emplace(nhg, index);
+        return index;
+    }
+
+    void release(uint32_t index)
+    {
+        if (--m_nhgRefCounts[index] != 0)
+        {
+            return;
+        }
+
+        m_nhgIndexes.erase(m_nhgs[index]);
+        m_nhgs[index] = RouteNhg();
+        m_freeNhgs.push_back(index);
+    }
+
+    size_t slotCount() const
+    {
+        return m_v4Routes.capacity() + m_v6Routes.capacity();
+    }
+
+    bool isOccupied(size_t pos) const
+    {
+        if (pos < m_v4Routes.capacity())
+        {
+            return m_v4Routes.slotAt(pos).value != Ipv4Map::EMPTY;
+        }
+        return m_v6Routes.slotAt(pos - m_v4Routes.capacity()).value != Ipv6Map::EMPTY;
+    }
+
+    value_type entryAt(size_t pos) const
+    {
+        ip_addr_t ip;
+
+        if (pos < m_v4Routes.capacity())
+        {
+            const auto &slot = m_v4Routes.slotAt(pos);
+            ip.family = AF_INET;
+            ip.ip_addr.ipv4_addr = slot.key.addr;
+            return value_type(IpPrefix(ip, slot.key.len), m_nhgs[slot.value]);
+        }
+
+        const auto &slot = m_v6Routes.slotAt(pos - m_v4Routes.capacity());
+        ip.family = AF_INET6;
+        memcpy(ip.ip_addr.ipv6_addr, slot.key.addr, sizeof(slot.key.addr));
+        return value_type(IpPrefix(ip, slot.key.len), m_nhgs[slot.value]);
+    }
+};
+
+#endif /* SWSS_ROUTETABLE_H */
@@ -0,0 +1,94 @@
+#include "statewriter.h"
+
+#include <inttypes.h>
+
+#include "logger.h"
+
+using namespace std;
+using namespace swss;
+
+StateWriter::PendingWrite &StateWriter::getPendingWrite(DBConnector *db, const string &table, const string &key)
+{
+    auto &dbWriter = m_dbs[db->getDbId()];
+    if (!dbWriter.pipeline)
+    {
+        dbWriter.pipeline = make_unique<RedisPipeline>(db);
+    }
+
+    auto &tablePtr = dbWriter.tables[table];
+    if (!tablePtr)
+    {
+        tablePtr = make_unique<Table>(dbWriter.pipeline.get(), table, true);
+    }
+
+    m_writes++;
+
+    auto it = m_index.find(make_pair(tablePtr.get(), key));
+    if (it != m_index.end())
+    {
+        m_coalesced++;
+        return m_pending[it->second];
+    }
+
+    m_index.emplace(make_pair(tablePtr.get(), key), m_pending.size());
+    m_pending.push_back({ tablePtr.get(), key, false, {} });
+
+    return m_pending.back();
+}
+
+void StateWriter::set(DBConnector *db, const string &table, const string &key, const vector<FieldValueTuple> &values)
+{
+    auto &write = getPendingWrite(db, table, key);
+
+    for (const auto &value : values)
+    {
+        write.values[fvField(value)] = fvValue(value);
+    }
+}
+
+void StateWriter::del(DBConnector *db, const string &table, const string &key)
+{
+    auto &write = getPendingWrite(db, table, key);
+
+    /* A set after the del rewrites the key from scratch */
+    write.del = true;
+    write.values.clear();
+}
+
+size_t StateWriter::flush()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pending.empty())
+    {
+        return 0;
+    }
+
+    vector<FieldValueTuple> values;
+    for (const auto &write : m_pending)
+    {
+        if (write.del)
+        {
+            write.table->del(write.key);
+        }
+        if (!write.values.empty())
+        {
+            values.assign(write.values.begin(), write.values.end());
+            write.table->set(write.key, values);
+        }
+    }
+
+    for (auto &it : m_dbs)
+    {
+        it.second.pipeline->flush();
+    }
+
+    size_t count = m_pending.size();
+    m_pending.clear();
+    m_index.clear();
+
+    SWSS_LOG_DEBUG("Wrote %zu state keys, %" PRIu64 " of %" PRIu64 " updates coalesced so far",
+                   count, m_coalesced, m_writes);
+
+    return count;
+}
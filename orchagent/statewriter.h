@@ -0,0 +1,61 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dbconnector.h"
+#include "redispipeline.h"
+#include "table.h"
+
+/*
+ * Updates of the STATE_DB and APPL_STATE_DB tables of an orch, kept in memory
+ * until flush(). The writes to a key are collapsed into one, so a key updated
+ * several times in a loop iteration of OrchDaemon is written once, and all
+ * the keys are written through one redis pipeline per DB.
+ */
+class StateWriter
+{
+public:
+    /* Set the fields of the key, the other fields of the key are kept as with Table::set() */
+    void set(swss::DBConnector *db, const std::string &table, const std::string &key,
+             const std::vector<swss::FieldValueTuple> &values);
+    void del(swss::DBConnector *db, const std::string &table, const std::string &key);
+
+    /* Write the pending updates, returns the number of keys written */
+    size_t flush();
+
+    size_t getPendingCount() const { return m_pending.size(); }
+    /* Updates requested, and updates collapsed into a pending update of the same key */
+    uint64_t getWriteCount() const { return m_writes; }
+    uint64_t getCoalescedCount() const { return m_coalesced; }
+
+private:
+    struct PendingWrite
+    {
+        swss::Table *table;
+        std::string key;
+        bool del;
+        /* Fields by name, so that merging a set is not linear in the fields already pending */
+        std::map<std::string, std::string> values;
+    };
+
+    struct DbWriter
+    {
+        std::unique_ptr<swss::RedisPipeline> pipeline;
+        std::map<std::string, std::unique_ptr<swss::Table>> tables;
+    };
+
+    PendingWrite &getPendingWrite(swss::DBConnector *db, const std::string &table, const std::string &key);
+
+    std::map<int, DbWriter> m_dbs;
+
+    /* Pending updates in order of their first write, and their index by table and key */
+    std::vector<PendingWrite> m_pending;
+    std::map<std::pair<swss::Table *, std::string>, size_t> m_index;
+
+    uint64_t m_writes = 0;
+    uint64_t m_coalesced = 0;
+};
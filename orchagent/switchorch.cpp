@@ -13,7 +13,6 @@
 #include "saihelper.h"
 #include "sai_serialize.h"
 #include "notifications.h"
-#include "redisapi.h"
 
 using namespace std;
 using namespace swss;
@@ -214,25 +213,113 @@ void SwitchOrch::initAsicSdkHealthEventNotification()
 
     if (atLeastOneSupported)
     {
-        try
+        m_eliminateEventsPipeline = unique_ptr<RedisPipeline>(new RedisPipeline(m_stateDb.get()));
+        m_eliminateEventsTable = unique_ptr<Table>(new Table(m_eliminateEventsPipeline.get(), STATE_ASIC_SDK_HEALTH_EVENT_TABLE_NAME, true));
+        loadAsicSdkHealthEvents();
+
+        // Init timer
+        auto interv = timespec { .tv_sec = ASIC_SDK_HEALTH_EVENT_ELIMINATE_INTERVAL, .tv_nsec = 0 };
+        m_eliminateEventsTimer = new SelectableTimer(interv);
+        auto executor = new ExecutableTimer(m_eliminateEventsTimer, this, "ASIC_SDK_HEALTH_EVENT_ELIMINATE_TIMER");
+        Orch::addExecutor(executor);
+        m_eliminateEventsTimer->start();
+    }
+}
+
+/*
+ * Index the events recorded before orchagent started, e.g. before a restart of swss.
+ * This is the only time the keys of the table are read, the events received afterwards
+ * are indexed when they are written.
+ */
+void SwitchOrch::loadAsicSdkHealthEvents()
+{
+    SWSS_LOG_ENTER();
+
+    vector<string> keys;
+    m_eliminateEventsTable->getKeys(keys);
+
+    for (const auto &key : keys)
+    {
+        string severity;
+        if (m_eliminateEventsTable->hget(key, "severity", severity))
         {
-            // Load the Lua script to eliminate oldest entries
-            string eliminateEventsLuaScript = swss::loadLuaScript("eliminate_events.lua");
-            m_eliminateEventsSha = swss::loadRedisScript(m_stateDb.get(), eliminateEventsLuaScript);
-
-            // Init timer
-            auto interv = timespec { .tv_sec = ASIC_SDK_HEALTH_EVENT_ELIMINATE_INTERVAL, .tv_nsec = 0 };
-            m_eliminateEventsTimer = new SelectableTimer(interv);
-            auto executor = new ExecutableTimer(m_eliminateEventsTimer, this, "ASIC_SDK_HEALTH_EVENT_ELIMINATE_TIMER");
-            Orch::addExecutor(executor);
-            m_eliminateEventsTimer->start();
+            addAsicSdkHealthEvent(key, severity);
         }
-        catch (...)
+    }
+
+    SWSS_LOG_INFO("Loaded %zu ASIC/SDK health events", keys.size());
+}
+
+void SwitchOrch::addAsicSdkHealthEvent(const string &key, const string &severity)
+{
+    lock_guard<mutex> lock(m_asicSdkHealthEventLock);
+
+    // An event received in the same second overwrites the previous one, including its severity
+    auto it = m_asicSdkHealthEventSeverities.find(key);
+    if (it != m_asicSdkHealthEventSeverities.end())
+    {
+        m_asicSdkHealthEvents[it->second].erase(key);
+        it->second = severity;
+    }
+    else
+    {
+        m_asicSdkHealthEventSeverities.emplace(key, severity);
+    }
+
+    m_asicSdkHealthEvents[severity].insert(key);
+}
+
+/*
+ * Remove the oldest events of the severities exceeding the max_events configured in
+ * SUPPRESS_ASIC_SDK_HEALTH_EVENT. The keys are the time of the events, so the index
+ * of each severity is sorted from the oldest to the newest event.
+ */
+void SwitchOrch::eliminateAsicSdkHealthEvents()
+{
+    SWSS_LOG_ENTER();
+
+    vector<string> eliminatedEvents;
+
+    {
+        lock_guard<mutex> lock(m_asicSdkHealthEventLock);
+
+        for (const auto &maxEvents : m_asicSdkHealthEventMaxEvents)
         {
-            // This can happen only on mock test. If it happens on a real switch, we should log an error message
-            SWSS_LOG_ERROR("Unable to load the Lua script to eliminate events\n");
+            const auto &severity = maxEvents.first;
+            auto &events = m_asicSdkHealthEvents[severity];
+            size_t receivedEvents = events.size();
+
+            if (receivedEvents <= maxEvents.second)
+            {
+                SWSS_LOG_INFO("Eliminate ASIC/SDK health %s events: maximum %u, received %zu, not exceeding the maximum",
+                              severity.c_str(), maxEvents.second, receivedEvents);
+                continue;
+            }
+
+            size_t eventsToEliminate = receivedEvents - maxEvents.second;
+            auto last = next(events.begin(), eventsToEliminate);
+            for (auto it = events.begin(); it != last; it++)
+            {
+                m_asicSdkHealthEventSeverities.erase(*it);
+                eliminatedEvents.push_back(*it);
+            }
+            events.erase(events.begin(), last);
+
+            SWSS_LOG_INFO("Eliminate ASIC/SDK health %s events: maximum %u, received %zu, eliminated %zu",
+                          severity.c_str(), maxEvents.second, receivedEvents, eventsToEliminate);
         }
     }
+
+    if (eliminatedEvents.empty())
+    {
+        return;
+    }
+
+    for (const auto &key : eliminatedEvents)
+    {
+        m_eliminateEventsTable->del(key);
+    }
+    m_eliminateEventsPipeline->flush();
 }
 
 void SwitchOrch::initAclGroupsBindToSwitch()
@@ -944,6 +1031,30 @@ void SwitchOrch::registerAsicSdkHealthEventCategories(sai_switch_attr_t saiSever
     }
 }
 
+void SwitchOrch::updateAsicSdkHealthEventMaxEvents(const string &severity, const vector<FieldValueTuple> &fieldValues)
+{
+    lock_guard<mutex> lock(m_asicSdkHealthEventLock);
+
+    m_asicSdkHealthEventMaxEvents.erase(severity);
+
+    for (const auto &fv : fieldValues)
+    {
+        if (fvField(fv) != "max_events")
+        {
+            continue;
+        }
+
+        try
+        {
+            m_asicSdkHealthEventMaxEvents[severity] = to_uint<uint32_t>(fvValue(fv));
+        }
+        catch (const exception &e)
+        {
+            SWSS_LOG_ERROR("Invalid max_events %s for severity %s: %s", fvValue(fv).c_str(), severity.c_str(), e.what());
+        }
+    }
+}
+
 void SwitchOrch::doCfgSuppressAsicSdkHealthEventTableTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
@@ -982,6 +1093,9 @@ void SwitchOrch::doCfgSuppressAsicSdkHealthEventTableTask(Consumer &consumer)
         {
             bool categoriesConfigured = false;
             bool continueMainLoop = false;
+
+            updateAsicSdkHealthEventMaxEvents(key, kfvFieldsValues(keyOpFieldsValues));
+
             for (const auto &cit : kfvFieldsValues(keyOpFieldsValues))
             {
                 auto fieldName = fvField(cit);
@@ -1016,6 +1130,7 @@ void SwitchOrch::doCfgSuppressAsicSdkHealthEventTableTask(Consumer &consumer)
         }
         else if (op == DEL_COMMAND)
         {
+            updateAsicSdkHealthEventMaxEvents(key, {});
             registerAsicSdkHealthEventCategories(saiSeverity, key);
         }
         else
@@ -1174,6 +1289,7 @@ void SwitchOrch::onSwitchAsicSdkHealthEvent(sai_object_id_t switch_id,
     values.emplace_back("description", description_str);
 
     m_asicSdkHealthEventTable->set(time_ss.str(),values);
+    addAsicSdkHealthEvent(time_ss.str(), severity_str);
 
     event_publish(g_events_handle, "asic-sdk-health-event", &params);
 
@@ -1298,11 +1414,7 @@ void SwitchOrch::doTask(SelectableTimer &timer)
     }
     else if (&timer == m_eliminateEventsTimer)
     {
-        auto ret = swss::runRedisScript(*m_stateDb, m_eliminateEventsSha, {}, {});
-        for (auto str: ret)
-        {
-            SWSS_LOG_INFO("Eliminate ASIC/SDK health %s", str.c_str());
-        }
+        eliminateAsicSdkHealthEvents();
     }
 }
 
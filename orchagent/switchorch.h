@@ -1,7 +1,10 @@
 #pragma once
 
+#include <mutex>
+
 #include "acltable.h"
 #include "orch.h"
+#include "redispipeline.h"
 #include "timer.h"
 #include "switch/switch_capabilities.h"
 #include "switch/switch_helper.h"
@@ -128,11 +131,24 @@ private:
     std::shared_ptr<swss::DBConnector> m_stateDbForNotification = nullptr;
     std::shared_ptr<swss::Table> m_asicSdkHealthEventTable = nullptr;
     std::set<sai_switch_attr_t> m_supportedAsicSdkHealthEventAttributes;
-    std::string m_eliminateEventsSha;
     swss::SelectableTimer* m_eliminateEventsTimer = nullptr;
     uint32_t m_fatalEventCount = 0;
 
+    // Index of the ASIC SDK health events in STATE_DB, used to eliminate the oldest
+    // events of each severity without listing the keys of the table in redis.
+    // The events are written by the SAI notification thread, hence the lock.
+    std::mutex m_asicSdkHealthEventLock;
+    std::map<std::string, std::set<std::string>> m_asicSdkHealthEvents;     // Severity -> event keys, oldest first
+    std::map<std::string, std::string> m_asicSdkHealthEventSeverities;      // Event key -> severity
+    std::map<std::string, uint32_t> m_asicSdkHealthEventMaxEvents;          // Severity -> max_events in CONFIG_DB
+    std::unique_ptr<swss::RedisPipeline> m_eliminateEventsPipeline;
+    std::unique_ptr<swss::Table> m_eliminateEventsTable;
+
     void initAsicSdkHealthEventNotification();
+    void loadAsicSdkHealthEvents();
+    void addAsicSdkHealthEvent(const std::string &key, const std::string &severity);
+    void updateAsicSdkHealthEventMaxEvents(const std::string &severity, const std::vector<swss::FieldValueTuple> &fieldValues);
+    void eliminateAsicSdkHealthEvents();
     void registerAsicSdkHealthEventCategories(sai_switch_attr_t saiSeverity, const std::string &severityString, const std::string &suppressed_category_list="", bool isInitializing=false);
 
     // Switch hash SAI defaults
@@ -0,0 +1,138 @@
+#ifndef SWSS_TWAMPHISTOGRAM_H
+#define SWSS_TWAMPHISTOGRAM_H
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+/*
+ * Fixed size histogram of TWAMP latency or jitter samples.
+ *
+ * Values below TWAMP_HISTOGRAM_SUB_BUCKETS are counted exactly, larger
+ * values are counted in TWAMP_HISTOGRAM_SUB_BUCKETS linear sub-buckets per
+ * power of two, which bounds the relative error of a bucket to 1/8. Values
+ * at or above 2^TWAMP_HISTOGRAM_MAX_EXPONENT are counted in the last bucket.
+ *
+ * The histogram is a plain structure, it doesn't allocate and may be cleared
+ * with memset like the rest of TwampStats.
+ */
+#define TWAMP_HISTOGRAM_SUB_BUCKET_BITS    3
+#define TWAMP_HISTOGRAM_SUB_BUCKETS        (1u << TWAMP_HISTOGRAM_SUB_BUCKET_BITS)
+#define TWAMP_HISTOGRAM_MAX_EXPONENT       40
+#define TWAMP_HISTOGRAM_BUCKETS \
+    ((TWAMP_HISTOGRAM_MAX_EXPONENT - TWAMP_HISTOGRAM_SUB_BUCKET_BITS + 1) * TWAMP_HISTOGRAM_SUB_BUCKETS)
+
+struct TwampHistogram
+{
+    std::array<uint64_t, TWAMP_HISTOGRAM_BUCKETS> buckets;
+    /* Buckets updated since the last call of clearUpdated() */
+    std::array<uint64_t, (TWAMP_HISTOGRAM_BUCKETS + 63) / 64> updated;
+    uint64_t total;
+    uint64_t min;
+    uint64_t max;
+
+    void reset()
+    {
+        buckets.fill(0);
+        updated.fill(0);
+        total = 0;
+        min = 0;
+        max = 0;
+    }
+
+    static uint32_t getBucket(uint64_t value)
+    {
+        if (value < TWAMP_HISTOGRAM_SUB_BUCKETS)
+        {
+            return static_cast<uint32_t>(value);
+        }
+
+        uint32_t exponent = 63 - static_cast<uint32_t>(__builtin_clzll(value));
+        if (exponent >= TWAMP_HISTOGRAM_MAX_EXPONENT)
+        {
+            return TWAMP_HISTOGRAM_BUCKETS - 1;
+        }
+
+        uint32_t shift = exponent - TWAMP_HISTOGRAM_SUB_BUCKET_BITS;
+        uint32_t sub_bucket = static_cast<uint32_t>(value >> shift) & (TWAMP_HISTOGRAM_SUB_BUCKETS - 1);
+
+        return (shift + 1) * TWAMP_HISTOGRAM_SUB_BUCKETS + sub_bucket;
+    }
+
+    /* The largest value counted in the bucket */
+    static uint64_t getBucketUpperBound(uint32_t bucket)
+    {
+        if (bucket < TWAMP_HISTOGRAM_SUB_BUCKETS)
+        {
+            return bucket;
+        }
+
+        if (bucket >= TWAMP_HISTOGRAM_BUCKETS - 1)
+        {
+            return UINT64_MAX;
+        }
+
+        uint32_t shift = bucket / TWAMP_HISTOGRAM_SUB_BUCKETS - 1;
+        uint64_t sub_bucket = bucket % TWAMP_HISTOGRAM_SUB_BUCKETS;
+
+        return ((TWAMP_HISTOGRAM_SUB_BUCKETS + sub_bucket + 1) << shift) - 1;
+    }
+
+    void record(uint64_t value, uint64_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        uint32_t bucket = getBucket(value);
+        buckets[bucket] += count;
+        updated[bucket / 64] |= 1ULL << (bucket % 64);
+
+        min = (total == 0) ? value : std::min(min, value);
+        max = (total == 0) ? value : std::max(max, value);
+        total += count;
+    }
+
+    /*
+     * Estimate the value below which the given fraction of the samples fall.
+     * The upper bound of the bucket holding the sample is reported, limited to
+     * the range of the recorded values.
+     */
+    uint64_t getPercentile(double fraction) const
+    {
+        if (total == 0)
+        {
+            return 0;
+        }
+
+        uint64_t rank = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(total)));
+        rank = std::max<uint64_t>(rank, 1);
+
+        uint64_t seen = 0;
+        for (uint32_t bucket = 0; bucket < TWAMP_HISTOGRAM_BUCKETS; bucket++)
+        {
+            seen += buckets[bucket];
+            if (seen >= rank)
+            {
+                return std::max(min, std::min(max, getBucketUpperBound(bucket)));
+            }
+        }
+
+        return max;
+    }
+
+    bool isUpdated(uint32_t bucket) const
+    {
+        return (updated[bucket / 64] >> (bucket % 64)) & 1;
+    }
+
+    void clearUpdated()
+    {
+        updated.fill(0);
+    }
+};
+
+#endif /* SWSS_TWAMPHISTOGRAM_H */
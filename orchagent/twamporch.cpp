@@ -52,6 +52,24 @@ using namespace swss;
 #define TWAMP_SESSION_TIMEOUT_MIN    1
 #define TWAMP_SESSION_TIMEOUT_MAX    10
 
+/*
+ * TWAMP session latency and jitter distribution counters.
+ *
+ * SAI only reports the min/avg/max latency and jitter of each stats interval,
+ * not the per packet samples, so the histograms are built from those three
+ * values (see calculateCounters) and the percentiles are estimates: they only
+ * move away from the averages when the interval min or max does. The fields
+ * are named *_EST_* to tell them apart from measured percentiles.
+ */
+#define TWAMP_SESSION_STAT_LATENCY_EST_P50      "LATENCY_EST_P50"
+#define TWAMP_SESSION_STAT_LATENCY_EST_P99      "LATENCY_EST_P99"
+#define TWAMP_SESSION_STAT_LATENCY_EST_P999     "LATENCY_EST_P999"
+#define TWAMP_SESSION_STAT_JITTER_EST_P50       "JITTER_EST_P50"
+#define TWAMP_SESSION_STAT_JITTER_EST_P99       "JITTER_EST_P99"
+#define TWAMP_SESSION_STAT_JITTER_EST_P999      "JITTER_EST_P999"
+#define TWAMP_SESSION_LATENCY_HISTOGRAM     "LATENCY_HISTOGRAM"
+#define TWAMP_SESSION_JITTER_HISTOGRAM      "JITTER_HISTOGRAM"
+
 static map<string, sai_twamp_session_role_t> twamp_role_map =
 {
     { "SENDER",       SAI_TWAMP_SESSION_ROLE_SENDER    },
@@ -104,6 +122,21 @@ const vector<sai_twamp_session_stat_t> twamp_session_stat_ids =
     SAI_TWAMP_SESSION_STAT_AVG_JITTER
 };
 
+static const vector<string>& getTwampSessionStatNames()
+{
+    static const vector<string> names = []()
+    {
+        vector<string> stat_names;
+        for (const auto& id: twamp_session_stat_ids)
+        {
+            stat_names.push_back(sai_serialize_twamp_session_stat(id));
+        }
+        return stat_names;
+    }();
+
+    return names;
+}
+
 
 
 TwampOrch::TwampOrch(TableConnector confDbConnector, TableConnector stateDbConnector, SwitchOrch *switchOrch, PortsOrch *portOrch, VRFOrch *vrfOrch) :
@@ -283,6 +316,8 @@ void TwampOrch::initSessionStats(const string& name)
     total_stats.avg_jitter        = 0;
     total_stats.avg_latency_total = 0;
     total_stats.avg_jitter_total  = 0;
+    total_stats.latency_histogram.reset();
+    total_stats.jitter_histogram.reset();
 }
 
 bool TwampOrch::registerTwampEventNotification(void)
@@ -888,14 +923,15 @@ void TwampOrch::saveSessionStatsLatest(const sai_object_id_t session_id, const u
 {
     SWSS_LOG_ENTER();
 
-    vector<FieldValueTuple> values;
+    const auto& stat_names = getTwampSessionStatNames();
 
-    for (const auto& it: twamp_session_stat_ids)
+    m_counterValues.clear();
+    for (size_t i = 0; i < twamp_session_stat_ids.size(); i++)
     {
-        values.emplace_back(sai_serialize_twamp_session_stat(it), to_string(stats[it]));
+        m_counterValues.emplace_back(stat_names[i], to_string(stats[twamp_session_stat_ids[i]]));
     }
 
-    m_countersTable->set(sai_serialize_object_id(session_id) + ":INDEX:" + to_string(index), values);
+    m_countersTable->set(sai_serialize_object_id(session_id) + ":INDEX:" + to_string(index), m_counterValues);
 
     return;
 }
@@ -936,14 +972,29 @@ void TwampOrch::calculateCounters(const string& name, const uint32_t index, cons
                                 stats[SAI_TWAMP_SESSION_STAT_MIN_JITTER] : total_stats.min_jitter);
     total_stats.avg_jitter_total += stats[SAI_TWAMP_SESSION_STAT_AVG_JITTER];
     total_stats.avg_jitter = total_stats.avg_jitter_total / index;
+
+    /*
+     * The notification only carries the min/avg/max of the interval, so the
+     * received packets are counted at the interval average, except for one
+     * packet at each of the interval min and max to keep the tail visible.
+     */
+    uint64_t rx_packets = stats[SAI_TWAMP_SESSION_STAT_RX_PACKETS];
+    uint64_t avg_count = (rx_packets > 2) ? rx_packets - 2 : rx_packets;
+    if (rx_packets > 2)
+    {
+        total_stats.latency_histogram.record(stats[SAI_TWAMP_SESSION_STAT_MIN_LATENCY], 1);
+        total_stats.latency_histogram.record(stats[SAI_TWAMP_SESSION_STAT_MAX_LATENCY], 1);
+        total_stats.jitter_histogram.record(stats[SAI_TWAMP_SESSION_STAT_MIN_JITTER], 1);
+        total_stats.jitter_histogram.record(stats[SAI_TWAMP_SESSION_STAT_MAX_JITTER], 1);
+    }
+    total_stats.latency_histogram.record(stats[SAI_TWAMP_SESSION_STAT_AVG_LATENCY], avg_count);
+    total_stats.jitter_histogram.record(stats[SAI_TWAMP_SESSION_STAT_AVG_JITTER], avg_count);
 }
 
 void TwampOrch::saveCountersTotal(const string& name, const sai_object_id_t session_id)
 {
     SWSS_LOG_ENTER();
 
-    vector<FieldValueTuple> values;
-
     auto it = m_twampStatistics.find(name);
     if (it == m_twampStatistics.end())
     {
@@ -953,20 +1004,68 @@ void TwampOrch::saveCountersTotal(const string& name, const sai_object_id_t sess
     }
 
     TwampStats& total_stats = it->second;
+    const auto& stat_names = getTwampSessionStatNames();
+    const uint64_t totals[] =
+    {
+        total_stats.rx_packets,
+        total_stats.rx_bytes,
+        total_stats.tx_packets,
+        total_stats.tx_bytes,
+        total_stats.drop_packets,
+        total_stats.max_latency,
+        total_stats.min_latency,
+        total_stats.avg_latency,
+        total_stats.max_jitter,
+        total_stats.min_jitter,
+        total_stats.avg_jitter
+    };
+
+    m_counterValues.clear();
+    for (size_t i = 0; i < stat_names.size(); i++)
+    {
+        m_counterValues.emplace_back(stat_names[i], to_string(totals[i]));
+    }
 
-    values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_RX_PACKETS), to_string(total_stats.rx_packets));
-    values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_RX_BYTE), to_string(total_stats.rx_bytes));
-    values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_TX_PACKETS), to_string(total_stats.tx_packets));
-    values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_TX_BYTE), to_string(total_stats.tx_bytes));
-    values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_DROP_PACKETS), to_string(total_stats.drop_packets));
-    values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_MAX_LATENCY), to_string(total_stats.max_latency));
-    values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_MIN_LATENCY), to_string(total_stats.min_latency));
-    values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_AVG_LATENCY), to_string(total_stats.avg_latency));
-    values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_MAX_JITTER), to_string(total_stats.max_jitter));
-    values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_MIN_JITTER), to_string(total_stats.min_jitter));
-    values.emplace_back(sai_serialize_twamp_session_stat(SAI_TWAMP_SESSION_STAT_AVG_JITTER), to_string(total_stats.avg_jitter));
-
-    m_countersTable->set(sai_serialize_object_id(session_id), values);
+    const TwampHistogram& latency = total_stats.latency_histogram;
+    const TwampHistogram& jitter = total_stats.jitter_histogram;
+    m_counterValues.emplace_back(TWAMP_SESSION_STAT_LATENCY_EST_P50, to_string(latency.getPercentile(0.5)));
+    m_counterValues.emplace_back(TWAMP_SESSION_STAT_LATENCY_EST_P99, to_string(latency.getPercentile(0.99)));
+    m_counterValues.emplace_back(TWAMP_SESSION_STAT_LATENCY_EST_P999, to_string(latency.getPercentile(0.999)));
+    m_counterValues.emplace_back(TWAMP_SESSION_STAT_JITTER_EST_P50, to_string(jitter.getPercentile(0.5)));
+    m_counterValues.emplace_back(TWAMP_SESSION_STAT_JITTER_EST_P99, to_string(jitter.getPercentile(0.99)));
+    m_counterValues.emplace_back(TWAMP_SESSION_STAT_JITTER_EST_P999, to_string(jitter.getPercentile(0.999)));
+
+    const string key = sai_serialize_object_id(session_id);
+    m_countersTable->set(key, m_counterValues);
+
+    saveHistogram(key + ":" + TWAMP_SESSION_LATENCY_HISTOGRAM, total_stats.latency_histogram);
+    saveHistogram(key + ":" + TWAMP_SESSION_JITTER_HISTOGRAM, total_stats.jitter_histogram);
+}
+
+/*
+ * The raw histogram is kept with one field per non-empty bucket, named by the
+ * largest value counted in the bucket. Only the buckets updated since the last
+ * save are written.
+ */
+void TwampOrch::saveHistogram(const string& key, TwampHistogram& histogram)
+{
+    SWSS_LOG_ENTER();
+
+    m_counterValues.clear();
+    for (uint32_t bucket = 0; bucket < TWAMP_HISTOGRAM_BUCKETS; bucket++)
+    {
+        if (histogram.isUpdated(bucket))
+        {
+            m_counterValues.emplace_back(to_string(TwampHistogram::getBucketUpperBound(bucket)),
+                                         to_string(histogram.buckets[bucket]));
+        }
+    }
+    histogram.clearUpdated();
+
+    if (!m_counterValues.empty())
+    {
+        m_countersTable->set(key, m_counterValues);
+    }
 }
 
 void TwampOrch::doTask(NotificationConsumer& consumer)
@@ -1030,8 +1129,8 @@ void TwampOrch::doTask(NotificationConsumer& consumer)
                     addCounterNameMap(name, session_id);
                 }
 
-                vector<uint64_t> hw_stats;
-                hw_stats.resize(twamp_session_stat_ids.size());
+                vector<uint64_t>& hw_stats = m_hwStats;
+                hw_stats.assign(twamp_session_stat_ids.size(), 0);
                 for (uint32_t j = 0; j < twamp_session[i].session_stats.number_of_counters; j++)
                 {
                     uint32_t counters_id = twamp_session[i].session_stats.counters_ids[j];
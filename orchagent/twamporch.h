@@ -8,6 +8,7 @@
 #include "vrforch.h"
 #include "ipaddress.h"
 #include "table.h"
+#include "twamphistogram.h"
 #include <map>
 
 struct TwampStats
@@ -25,6 +26,8 @@ struct TwampStats
     uint64_t avg_jitter;
     uint64_t avg_latency_total;
     uint64_t avg_jitter_total;
+    TwampHistogram latency_histogram;
+    TwampHistogram jitter_histogram;
 };
 
 struct TwampEntry
@@ -105,6 +108,10 @@ private:
     unique_ptr<Table> m_vidToRidTable;
     Table m_stateDbTwampTable;
 
+    /* Buffers reused by every stats notification */
+    vector<uint64_t> m_hwStats;
+    vector<FieldValueTuple> m_counterValues;
+
     bool validateUdpPort(uint16_t udp_port);
     void increaseTwampSessionCount(void);
     void decreaseTwampSessionCount(void);
@@ -130,6 +137,7 @@ private:
     void saveSessionStatsLatest(const sai_object_id_t session_id, const uint32_t index, const vector<uint64_t>& stats);
     void calculateCounters(const string&, const uint32_t index, const vector<uint64_t>& stats);
     void saveCountersTotal(const string&, const sai_object_id_t session_id);
+    void saveHistogram(const string& key, TwampHistogram& histogram);
     void doTask(NotificationConsumer& consumer);
 };
 
@@ -730,8 +730,6 @@ VNetRouteOrch::VNetRouteOrch(DBConnector *db, vector<string> &tableNames, VNetOr
     state_db_ = shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
     app_db_ = shared_ptr<DBConnector>(new DBConnector("APPL_DB", 0));
 
-    state_vnet_rt_tunnel_table_ = unique_ptr<Table>(new Table(state_db_.get(), STATE_VNET_RT_TUNNEL_TABLE_NAME));
-    state_vnet_rt_adv_table_ = unique_ptr<Table>(new Table(state_db_.get(), STATE_ADVERTISE_NETWORK_TABLE_NAME));
     monitor_session_producer_ = unique_ptr<Table>(new Table(app_db_.get(), APP_VNET_MONITOR_TABLE_NAME));
 
     gBfdOrch->attach(this);
@@ -852,6 +850,7 @@ bool VNetRouteOrch::addNextHopGroup(const string& vnet, const NextHopGroupKey &n
      */
     next_hop_group_entry.ref_count = 0;
     syncd_nexthop_groups_[vnet][nexthops] = next_hop_group_entry;
+    addNextHopGroupIndex(vnet, nexthops);
 
     return true;
 }
@@ -904,6 +903,7 @@ bool VNetRouteOrch::removeNextHopGroup(const string& vnet, const NextHopGroupKey
     gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP);
 
     syncd_nexthop_groups_[vnet].erase(nexthops);
+    removeNextHopGroupIndex(vnet, nexthops);
 
     return true;
 }
@@ -929,6 +929,7 @@ bool VNetRouteOrch::createNextHopGroup(const string& vnet,
             next_hop_group_entry.active_members[nexthop] = SAI_NULL_OBJECT_ID;
         }
         syncd_nexthop_groups_[vnet][nexthops] = next_hop_group_entry;
+        addNextHopGroupIndex(vnet, nexthops);
     }
     else
     {
@@ -941,6 +942,47 @@ bool VNetRouteOrch::createNextHopGroup(const string& vnet,
     return true;
 }
 
+void VNetRouteOrch::addNextHopGroupIndex(const string& vnet, const NextHopGroupKey& nexthops)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto& nh : nexthops.getNextHops())
+    {
+        nexthop_groups_by_endpoint_[vnet][nh].insert(nexthops);
+    }
+}
+
+void VNetRouteOrch::removeNextHopGroupIndex(const string& vnet, const NextHopGroupKey& nexthops)
+{
+    SWSS_LOG_ENTER();
+
+    auto it_vnet = nexthop_groups_by_endpoint_.find(vnet);
+    if (it_vnet == nexthop_groups_by_endpoint_.end())
+    {
+        return;
+    }
+
+    for (const auto& nh : nexthops.getNextHops())
+    {
+        auto it_nh = it_vnet->second.find(nh);
+        if (it_nh == it_vnet->second.end())
+        {
+            continue;
+        }
+
+        it_nh->second.erase(nexthops);
+        if (it_nh->second.empty())
+        {
+            it_vnet->second.erase(it_nh);
+        }
+    }
+
+    if (it_vnet->second.empty())
+    {
+        nexthop_groups_by_endpoint_.erase(it_vnet);
+    }
+}
+
 NextHopGroupKey VNetRouteOrch::getActiveNHSet(const string& vnet,
                                        NextHopGroupKey& nexthops,
                                        const IpPrefix& ipPrefix)
@@ -1057,6 +1099,7 @@ bool VNetRouteOrch::selectNextHopGroup(const string& vnet,
             next_hop_group_entry.next_hop_group_id = SAI_NULL_OBJECT_ID;
             next_hop_group_entry.ref_count = 0;
             syncd_nexthop_groups_[vnet][nhg_custom] = next_hop_group_entry;
+            addNextHopGroupIndex(vnet, nhg_custom);
         }
         nexthops_selected = nhg_custom;
         return true;
@@ -1215,6 +1258,7 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
                     else
                     {
                         syncd_nexthop_groups_[vnet].erase(nhg);
+                        removeNextHopGroupIndex(vnet, nhg);
                         if(nhg.getSize() == 1)
                         {
                             NextHopKey nexthop(nhg.to_string(), true);
@@ -1307,6 +1351,7 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
             else
             {
                 syncd_nexthop_groups_[vnet].erase(nhg);
+                removeNextHopGroupIndex(vnet, nhg);
                 // We need to check specifically if there is only one next hop active.
                 // In case of Priority routes we can end up in a situation where the active NHG has 0 nexthops.
                 if(nhg.getSize() == 1)
@@ -2100,7 +2145,7 @@ void VNetRouteOrch::postRouteState(const string& vnet, IpPrefix& ipPrefix, NextH
     fvVector.emplace_back("active_endpoints", ep_str);
     fvVector.emplace_back("state", route_state);
 
-    state_vnet_rt_tunnel_table_->set(state_db_key, fvVector);
+    m_stateWriter.set(state_db_.get(), STATE_VNET_RT_TUNNEL_TABLE_NAME, state_db_key, fvVector);
 
     auto prefix_to_use = ipPrefix;
     if (prefix_to_adv_prefix_.find(ipPrefix) != prefix_to_adv_prefix_.end())
@@ -2137,7 +2182,7 @@ void VNetRouteOrch::postRouteState(const string& vnet, IpPrefix& ipPrefix, NextH
 void VNetRouteOrch::removeRouteState(const string& vnet, IpPrefix& ipPrefix)
 {
     const string state_db_key = vnet + state_db_key_delimiter + ipPrefix.to_string();
-    state_vnet_rt_tunnel_table_->del(state_db_key);
+    m_stateWriter.del(state_db_.get(), STATE_VNET_RT_TUNNEL_TABLE_NAME, state_db_key);
 
     if(prefix_to_adv_prefix_.find(ipPrefix) !=prefix_to_adv_prefix_.end())
     {
@@ -2167,13 +2212,13 @@ void VNetRouteOrch::addRouteAdvertisement(IpPrefix& ipPrefix, string& profile)
     {
         fvs.push_back(FieldValueTuple("profile", profile));
     }
-    state_vnet_rt_adv_table_->set(key, fvs);
+    m_stateWriter.set(state_db_.get(), STATE_ADVERTISE_NETWORK_TABLE_NAME, key, fvs);
 }
 
 void VNetRouteOrch::removeRouteAdvertisement(IpPrefix& ipPrefix)
 {
     const string key = ipPrefix.to_string();
-    state_vnet_rt_adv_table_->del(key);
+    m_stateWriter.del(state_db_.get(), STATE_ADVERTISE_NETWORK_TABLE_NAME, key);
 }
 
 void VNetRouteOrch::update(SubjectType type, void *cntx)
@@ -2183,10 +2228,10 @@ void VNetRouteOrch::update(SubjectType type, void *cntx)
     assert(cntx);
 
     switch(type) {
-    case SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE:
+    case SUBJECT_TYPE_BFD_SESSION_STATE_BATCH_CHANGE:
     {
-        BfdUpdate *update = static_cast<BfdUpdate *>(cntx);
-        updateVnetTunnel(*update);
+        BfdUpdateBatch *batch = static_cast<BfdUpdateBatch *>(cntx);
+        updateVnetTunnel(*batch);
         break;
     }
     default:
@@ -2196,83 +2241,123 @@ void VNetRouteOrch::update(SubjectType type, void *cntx)
     }
 }
 
-void VNetRouteOrch::updateVnetTunnel(const BfdUpdate& update)
+void VNetRouteOrch::updateVnetTunnel(const BfdUpdateBatch& batch)
 {
     SWSS_LOG_ENTER();
 
-    auto key = update.peer;
-    sai_bfd_session_state_t state = update.state;
+    /* Last state of the endpoints changed in the batch, per vnet */
+    map<string, map<NextHopKey, sai_bfd_session_state_t>> endpoint_states;
 
-    size_t found_vrf = key.find(state_db_key_delimiter);
-    if (found_vrf == string::npos)
+    for (const auto& update : batch.updates)
     {
-        SWSS_LOG_WARN("Failed to parse key %s, no vrf is given", key.c_str());
-        return;
-    }
+        const auto& key = update.peer;
+        sai_bfd_session_state_t state = update.state;
 
-    size_t found_ifname = key.find(state_db_key_delimiter, found_vrf + 1);
-    if (found_ifname == string::npos)
-    {
-        SWSS_LOG_ERROR("Failed to parse key %s, no ifname is given", key.c_str());
-        return;
-    }
+        size_t found_vrf = key.find(state_db_key_delimiter);
+        if (found_vrf == string::npos)
+        {
+            SWSS_LOG_WARN("Failed to parse key %s, no vrf is given", key.c_str());
+            continue;
+        }
 
-    string vrf_name = key.substr(0, found_vrf);
-    string alias = key.substr(found_vrf + 1, found_ifname - found_vrf - 1);
-    IpAddress peer_address(key.substr(found_ifname + 1));
+        size_t found_ifname = key.find(state_db_key_delimiter, found_vrf + 1);
+        if (found_ifname == string::npos)
+        {
+            SWSS_LOG_ERROR("Failed to parse key %s, no ifname is given", key.c_str());
+            continue;
+        }
 
-    if (alias != "default" || vrf_name != "default")
-    {
-        return;
-    }
+        string vrf_name = key.substr(0, found_vrf);
+        string alias = key.substr(found_vrf + 1, found_ifname - found_vrf - 1);
+        IpAddress peer_address(key.substr(found_ifname + 1));
 
-    auto it_peer = bfd_sessions_.find(peer_address);
+        if (alias != "default" || vrf_name != "default")
+        {
+            continue;
+        }
 
-    if (it_peer == bfd_sessions_.end()) {
-        SWSS_LOG_INFO("No endpoint for BFD peer %s", peer_address.to_string().c_str());
-        return;
-    }
+        auto it_peer = bfd_sessions_.find(peer_address);
 
-    BfdSessionInfo& bfd_info = it_peer->second;
-    bfd_info.bfd_state = state;
+        if (it_peer == bfd_sessions_.end()) {
+            SWSS_LOG_INFO("No endpoint for BFD peer %s", peer_address.to_string().c_str());
+            continue;
+        }
 
-    string vnet = bfd_info.vnet;
-    NextHopKey endpoint = bfd_info.endpoint;
-    auto *vrf_obj = vnet_orch_->getTypePtr<VNetVrfObject>(vnet);
+        BfdSessionInfo& bfd_info = it_peer->second;
+        bfd_info.bfd_state = state;
 
-    if (syncd_nexthop_groups_.find(vnet) == syncd_nexthop_groups_.end())
-    {
-        SWSS_LOG_ERROR("Vnet %s not found", vnet.c_str());
-        return;
-    }
+        const string& vnet = bfd_info.vnet;
+        if (syncd_nexthop_groups_.find(vnet) == syncd_nexthop_groups_.end())
+        {
+            SWSS_LOG_ERROR("Vnet %s not found", vnet.c_str());
+            continue;
+        }
 
-    nexthop_info_[vnet][endpoint.ip_address].bfd_state = state;
+        nexthop_info_[vnet][bfd_info.endpoint.ip_address].bfd_state = state;
+        endpoint_states[vnet][bfd_info.endpoint] = state;
+    }
 
-    for (auto& nhg_info_pair : syncd_nexthop_groups_[vnet])
+    for (const auto& vnet_states : endpoint_states)
     {
-        NextHopGroupKey nexthops = nhg_info_pair.first;
-        NextHopGroupInfo& nhg_info = nhg_info_pair.second;
+        const string& vnet = vnet_states.first;
+        auto it_vnet = nexthop_groups_by_endpoint_.find(vnet);
+        if (it_vnet == nexthop_groups_by_endpoint_.end())
+        {
+            continue;
+        }
 
-        std::set<NextHopKey> next_hop_set = nexthops.getNextHops();
-        uint32_t seq_id = 0;
-        uint32_t nh_seq_id = 0;
-        for (auto nh: next_hop_set)
+        /* Each next hop group using any of the changed endpoints is updated once */
+        set<NextHopGroupKey> nexthop_groups;
+        for (const auto& endpoint_state : vnet_states.second)
         {
-            seq_id++;
-            if (nh == endpoint)
+            auto it_nh = it_vnet->second.find(endpoint_state.first);
+            if (it_nh != it_vnet->second.end())
             {
-                nh_seq_id = seq_id;
-                break;
+                nexthop_groups.insert(it_nh->second.begin(), it_nh->second.end());
             }
         }
 
-        if (!nh_seq_id)
+        for (const auto& nexthops : nexthop_groups)
+        {
+            updateNextHopGroupMembers(vnet, nexthops, vnet_states.second);
+        }
+    }
+}
+
+void VNetRouteOrch::updateNextHopGroupMembers(const string& vnet, const NextHopGroupKey& nexthops,
+                                              const map<NextHopKey, sai_bfd_session_state_t>& endpoint_states)
+{
+    SWSS_LOG_ENTER();
+
+    auto it_nhg = syncd_nexthop_groups_[vnet].find(nexthops);
+    if (it_nhg == syncd_nexthop_groups_[vnet].end())
+    {
+        return;
+    }
+
+    auto *vrf_obj = vnet_orch_->getTypePtr<VNetVrfObject>(vnet);
+    NextHopGroupInfo& nhg_info = it_nhg->second;
+    bool was_active = !nhg_info.active_members.empty();
+
+    std::set<NextHopKey> next_hop_set = nexthops.getNextHops();
+    uint32_t nh_seq_id = 0;
+    for (const auto& endpoint : next_hop_set)
+    {
+        nh_seq_id++;
+
+        auto it_state = endpoint_states.find(endpoint);
+        if (it_state == endpoint_states.end())
         {
             continue;
         }
 
-        if (state == SAI_BFD_SESSION_STATE_UP)
+        if (it_state->second == SAI_BFD_SESSION_STATE_UP)
         {
+            if (nhg_info.active_members.find(endpoint) != nhg_info.active_members.end())
+            {
+                continue;
+            }
+
             sai_object_id_t next_hop_group_member_id = SAI_NULL_OBJECT_ID;
             if (nexthops.getSize() > 1)
             {
@@ -2314,23 +2399,7 @@ void VNetRouteOrch::updateVnetTunnel(const BfdUpdate& update)
                 gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
             }
 
-            // Re-create routes when it was temporarily removed
-            if (nhg_info.active_members.empty())
-            {
-                nhg_info.active_members[endpoint] = next_hop_group_member_id;
-                if (vnet_orch_->isVnetExecVrf())
-                {
-                    for (auto ip_pfx : syncd_nexthop_groups_[vnet][nexthops].tunnel_routes)
-                    {
-                        string op = SET_COMMAND;
-                        updateTunnelRoute(vnet, ip_pfx, nexthops, op);
-                    }
-                }
-            }
-            else
-            {
-                nhg_info.active_members[endpoint] = next_hop_group_member_id;
-            }
+            nhg_info.active_members[endpoint] = next_hop_group_member_id;
         }
         else
         {
@@ -2355,32 +2424,30 @@ void VNetRouteOrch::updateVnetTunnel(const BfdUpdate& update)
                 gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
             }
 
-            if (nhg_info.active_members.find(endpoint) != nhg_info.active_members.end())
-            {
-                nhg_info.active_members.erase(endpoint);
-
-                // Remove routes when nexthop group has no active endpoint
-                if (nhg_info.active_members.empty())
-                {
-                    if (vnet_orch_->isVnetExecVrf())
-                    {
-                        for (auto ip_pfx : syncd_nexthop_groups_[vnet][nexthops].tunnel_routes)
-                        {
-                            string op = DEL_COMMAND;
-                            updateTunnelRoute(vnet, ip_pfx, nexthops, op);
-                        }
-                    }
-                }
-            }
+            nhg_info.active_members.erase(endpoint);
         }
+    }
+
+    bool is_active = !nhg_info.active_members.empty();
+    NextHopGroupKey nhg_key = nexthops;
 
-        // Post configured in State DB
-        for (auto ip_pfx : syncd_nexthop_groups_[vnet][nexthops].tunnel_routes)
+    // Re-create routes when they were temporarily removed, remove routes when
+    // the next hop group has no active endpoint
+    if (was_active != is_active && vnet_orch_->isVnetExecVrf())
+    {
+        string op = is_active ? SET_COMMAND : DEL_COMMAND;
+        for (auto ip_pfx : nhg_info.tunnel_routes)
         {
-            string profile = vrf_obj->getProfile(ip_pfx);
-            postRouteState(vnet, ip_pfx, nexthops, profile);
+            updateTunnelRoute(vnet, ip_pfx, nhg_key, op);
         }
     }
+
+    // Post configured in State DB
+    for (auto ip_pfx : nhg_info.tunnel_routes)
+    {
+        string profile = vrf_obj->getProfile(ip_pfx);
+        postRouteState(vnet, ip_pfx, nhg_key, profile);
+    }
 }
 
 void VNetRouteOrch::updateVnetTunnelCustomMonitor(const MonitorUpdate& update)
@@ -2493,6 +2560,7 @@ void VNetRouteOrch::updateVnetTunnelCustomMonitor(const MonitorUpdate& update)
             next_hop_group_entry.next_hop_group_id = SAI_NULL_OBJECT_ID;
             next_hop_group_entry.ref_count = 0;
             syncd_nexthop_groups_[vnet][nhg_custom] = next_hop_group_entry;
+            addNextHopGroupIndex(vnet, nhg_custom);
         }
     }
     auto active_nhg_size = active_nhg.getSize();
@@ -2556,6 +2624,7 @@ void VNetRouteOrch::updateVnetTunnelCustomMonitor(const MonitorUpdate& update)
             else
             {
                 syncd_nexthop_groups_[vnet].erase(active_nhg);
+                removeNextHopGroupIndex(vnet, active_nhg);
                 if(active_nhg_size == 1)
                 {
                     NextHopKey nexthop(active_nhg.to_string(), true);
@@ -409,6 +409,8 @@ typedef std::map<IpPrefix, VNetTunnelRouteEntry> VNetTunnelRouteTable;
 typedef std::map<IpAddress, BfdSessionInfo> BfdSessionTable;
 typedef std::map<IpPrefix, std::map<IpAddress, MonitorSessionInfo>> MonitorSessionTable;
 typedef std::map<IpAddress, VNetNextHopInfo> VNetEndpointInfoTable;
+/* VNetEndpointNextHopGroupIndex: endpoint, next hop groups using the endpoint */
+typedef std::map<NextHopKey, std::set<NextHopGroupKey>> VNetEndpointNextHopGroupIndex;
 
 class VNetRouteOrch : public Orch2, public Subject, public Observer
 {
@@ -460,7 +462,12 @@ private:
     void addRouteAdvertisement(IpPrefix& ipPrefix, string& profile);
     void removeRouteAdvertisement(IpPrefix& ipPrefix);
 
-    void updateVnetTunnel(const BfdUpdate&);
+    void addNextHopGroupIndex(const string& vnet, const NextHopGroupKey& nexthops);
+    void removeNextHopGroupIndex(const string& vnet, const NextHopGroupKey& nexthops);
+
+    void updateVnetTunnel(const BfdUpdateBatch&);
+    void updateNextHopGroupMembers(const string& vnet, const NextHopGroupKey& nexthops,
+                                   const std::map<NextHopKey, sai_bfd_session_state_t>& endpoint_states);
     void updateVnetTunnelCustomMonitor(const MonitorUpdate& update);
     bool updateTunnelRoute(const string& vnet, IpPrefix& ipPrefix, NextHopGroupKey& nexthops, string& op);
     void createSubnetDecapTerm(const IpPrefix &ipPrefix);
@@ -485,6 +492,7 @@ private:
     BfdSessionTable bfd_sessions_;
     std::map<std::string, MonitorSessionTable> monitor_info_;
     std::map<std::string, VNetEndpointInfoTable> nexthop_info_;
+    std::map<std::string, VNetEndpointNextHopGroupIndex> nexthop_groups_by_endpoint_;
     std::map<IpPrefix, IpPrefix> prefix_to_adv_prefix_;
     std::map<IpPrefix, int> adv_prefix_refcount_;
     std::set<IpPrefix> subnet_decap_terms_created_;
@@ -493,8 +501,6 @@ private:
     unique_ptr<Table> monitor_session_producer_;
     shared_ptr<DBConnector> state_db_;
     shared_ptr<DBConnector> app_db_;
-    unique_ptr<Table> state_vnet_rt_tunnel_table_;
-    unique_ptr<Table> state_vnet_rt_adv_table_;
 };
 
 class VNetCfgRouteOrch : public Orch
@@ -19,6 +19,7 @@ extern "C" {
 #include "tokenize.h"
 #include "sai_serialize.h"
 #include "flex_counter_manager.h"
+#include "counterrateorch.h"
 #include "converter.h"
 
 /* Global variables */
@@ -31,6 +32,7 @@ extern PortsOrch*       gPortsOrch;
 extern sai_object_id_t  gUnderlayIfId;
 extern FlexManagerDirectory g_FlexManagerDirectory;
 extern bool gTraditionalFlexCounter;
+extern bool gCounterRatesInOrch;
 
 #define FLEX_COUNTER_UPD_INTERVAL 1
 
@@ -1200,7 +1202,7 @@ VxlanTunnelOrch::VxlanTunnelOrch(DBConnector *statedb, DBConnector *db, const st
     }
 
     FieldValueTuple fv;
-    string tunnel_rate_plugin = "tunnel_rates.lua";
+    string tunnel_rate_plugin = gCounterRatesInOrch ? COUNTER_RATES_POLL_PLUGIN : "tunnel_rates.lua";
     m_counter_db = shared_ptr<DBConnector>(new DBConnector("COUNTERS_DB", 0));
     m_asic_db = shared_ptr<DBConnector>(new DBConnector("ASIC_DB", 0));
     try
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "zmqorch.h"
 
 using namespace swss;
@@ -24,7 +26,7 @@ void ZmqConsumer::execute()
 void ZmqConsumer::drain()
 {
     if (!m_toSync.empty())
-        (static_cast<ZmqOrch*>(m_orch))->doTask(*this);
+        (static_cast<ZmqOrch*>(m_orch))->doTaskAndRespond(*this);
 }
 
 
@@ -61,5 +63,43 @@ void ZmqOrch::addConsumer(DBConnector *db, string tableName, int pri, ZmqServer
 void ZmqOrch::doTask(Consumer &consumer)
 {
     // When ZMQ disabled, forward data from Consumer
-    doTask((ConsumerBase &)consumer);
+    doTaskAndRespond(consumer);
+}
+
+void ZmqOrch::doTaskAndRespond(ConsumerBase &consumer)
+{
+    if (!m_respond)
+    {
+        doTask(consumer);
+        return;
+    }
+
+    SyncMap entries = consumer.m_toSync;
+    doTask(consumer);
+
+    /*
+     * The entries left in m_toSync are retried, they are responded to once
+     * processed. The DASH orchs do not report a status per entry, the entries
+     * they dropped as invalid are logged by them and responded to as processed.
+     */
+    for (const auto &it : entries)
+    {
+        const auto &t = it.second;
+        auto range = consumer.m_toSync.equal_range(it.first);
+        if (std::any_of(range.first, range.second, [&](const SyncMap::value_type &left) { return left.second == t; }))
+        {
+            continue;
+        }
+
+        m_publisher.publish(consumer.getTableName(), kfvKey(t),
+                            kfvOp(t) == SET_COMMAND ? kfvFieldsValues(t) : vector<FieldValueTuple>{}, ReturnCode());
+    }
+}
+
+void ZmqOrch::setResponseZmqClient(ZmqClient *zmqClient)
+{
+    // The responses are sent in batches by flushResponses()
+    m_respond = zmqClient != nullptr;
+    m_publisher.setBuffered(m_respond);
+    m_publisher.setZmqClient(zmqClient);
 }
\ No newline at end of file
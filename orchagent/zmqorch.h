@@ -30,6 +30,14 @@ public:
     virtual void doTask(ConsumerBase &consumer) { };
     void doTask(Consumer &consumer) override;
 
+    // Run doTask() on the entries of the consumer, and respond to the processed ones
+    void doTaskAndRespond(ConsumerBase &consumer);
+
+    // Send a response to the DASH controller over ZMQ for each processed entry
+    void setResponseZmqClient(swss::ZmqClient *zmqClient) override;
+
 private:
     void addConsumer(swss::DBConnector *db, std::string tableName, int pri, swss::ZmqServer *zmqServer);
+
+    bool m_respond = false;
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <sys/socket.h>
 #include <net/if.h>
 #include <netlink/route/link.h>
+#include <linux/rtnetlink.h>
 #include "logger.h"
 #include "netmsg.h"
 #include "dbconnector.h"
@@ -16,10 +17,10 @@
 #include "warm_restart.h"
 #include "shellcmd.h"
 
+#include <chrono>
 #include <iostream>
 #include <set>
 #include <sstream>
-#include <iomanip>
 
 using namespace std;
 using namespace swss;
@@ -27,6 +28,9 @@ using namespace swss;
 #define VLAN_DRV_NAME   "bridge"
 #define TEAM_DRV_NAME   "team"
 
+/* RTM_SETLINK requests sent before reading their acks */
+#define SET_LINK_BATCH_SIZE 64
+
 const string MGMT_PREFIX = "eth";
 const string INTFS_PREFIX = "Ethernet";
 const string LAG_PREFIX = "PortChannel";
@@ -38,8 +42,9 @@ extern string g_switchType;
 LinkSync::LinkSync(DBConnector *appl_db, DBConnector *state_db) :
     m_portTableProducer(appl_db, APP_PORT_TABLE_NAME),
     m_portTable(appl_db, APP_PORT_TABLE_NAME),
-    m_statePortTable(state_db, STATE_PORT_TABLE_NAME),
-    m_stateMgmtPortTable(state_db, STATE_MGMT_PORT_TABLE_NAME)
+    m_statePipeline(state_db),
+    m_statePortTable(&m_statePipeline, STATE_PORT_TABLE_NAME, true),
+    m_stateMgmtPortTable(&m_statePipeline, STATE_MGMT_PORT_TABLE_NAME, true)
 {
     std::shared_ptr<struct if_nameindex> if_ni(if_nameindex(), if_freenameindex);
     struct if_nameindex *idx_p;
@@ -89,6 +94,8 @@ LinkSync::LinkSync(DBConnector *appl_db, DBConnector *state_db) :
         }
     }
 
+    flush();
+
     if (!WarmStart::isWarmStart())
     {
         /* See the comments for g_portSet in portsyncd.cpp */
@@ -136,25 +143,162 @@ LinkSync::LinkSync(DBConnector *appl_db, DBConnector *state_db) :
             }
 
             m_ifindexOldNameMap[idx_p->if_index] = key;
+        }
 
-            ostringstream cmd;
-            string res;
-            /* Bring down the existing kernel interfaces */
-            SWSS_LOG_INFO("Bring down old interface %s(%d)", key.c_str(), idx_p->if_index);
-            cmd << "ip link set " << quoted(key) << " down";
-            try
+        bringDownOldIfaces();
+    }
+}
+
+static struct nl_msg *build_set_link_down_message(unsigned int ifindex)
+{
+    struct nl_msg *msg = nlmsg_alloc();
+    if (!msg)
+    {
+        return nullptr;
+    }
+
+    if (!nlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, RTM_SETLINK, 0, NLM_F_REQUEST | NLM_F_ACK))
+    {
+        nlmsg_free(msg);
+        return nullptr;
+    }
+
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(struct ifinfomsg));
+    ifi.ifi_family = AF_UNSPEC;
+    ifi.ifi_index = static_cast<int>(ifindex);
+    ifi.ifi_change = IFF_UP;
+    ifi.ifi_flags = 0;
+
+    if (nlmsg_append(msg, &ifi, sizeof(struct ifinfomsg), NLMSG_ALIGNTO) < 0)
+    {
+        nlmsg_free(msg);
+        return nullptr;
+    }
+
+    return msg;
+}
+
+/*
+ * Read the acks of the RTM_SETLINK requests, pending maps the sequence number
+ * of the requests waiting for their ack to the ifindex of their interface.
+ */
+void LinkSync::recvSetLinkAcks(struct nl_sock *sk, map<uint32_t, unsigned int> &pending)
+{
+    while (!pending.empty())
+    {
+        struct sockaddr_nl nla;
+        unsigned char *buf = nullptr;
+
+        int len = nl_recv(sk, &nla, &buf, nullptr);
+        if (len <= 0)
+        {
+            SWSS_LOG_WARN("Failed to receive the acks of %zu old interfaces brought down, error '%s'",
+                          pending.size(), nl_geterror(len));
+            free(buf);
+            return;
+        }
+
+        struct nlmsghdr *hdr = reinterpret_cast<struct nlmsghdr *>(buf);
+        for (; nlmsg_ok(hdr, len); hdr = nlmsg_next(hdr, &len))
+        {
+            if (hdr->nlmsg_type != NLMSG_ERROR)
             {
-                swss::exec(cmd.str(), res);
+                continue;
             }
-            catch (...)
+
+            auto it = pending.find(hdr->nlmsg_seq);
+            if (it == pending.end())
+            {
+                continue;
+            }
+
+            struct nlmsgerr *err = static_cast<struct nlmsgerr *>(nlmsg_data(hdr));
+            if (err->error)
             {
                 /* Ignore error in this flow ; */
-                SWSS_LOG_WARN("Failed to bring down old interface %s(%d)", key.c_str(), idx_p->if_index);
+                SWSS_LOG_WARN("Failed to bring down old interface %s(%d), error: %s",
+                              m_ifindexOldNameMap[it->second].c_str(), it->second, strerror(-err->error));
             }
+            pending.erase(it);
         }
+
+        free(buf);
     }
 }
 
+/*
+ * Bring down the existing kernel front panel interfaces, the equivalent of
+ * "ip link set <port> down" for each of them, with RTM_SETLINK requests sent
+ * in batches on a netlink socket.
+ */
+void LinkSync::bringDownOldIfaces()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_ifindexOldNameMap.empty())
+    {
+        return;
+    }
+
+    auto start = chrono::steady_clock::now();
+
+    struct nl_sock *sk = nl_socket_alloc();
+    if (!sk)
+    {
+        SWSS_LOG_ERROR("Netlink socket alloc failed, old interfaces are not brought down");
+        return;
+    }
+
+    int err = nl_connect(sk, NETLINK_ROUTE);
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("Netlink socket connect failed, error '%s', old interfaces are not brought down", nl_geterror(err));
+        nl_socket_free(sk);
+        return;
+    }
+
+    map<uint32_t, unsigned int> pending;
+    for (const auto &iface : m_ifindexOldNameMap)
+    {
+        SWSS_LOG_INFO("Bring down old interface %s(%d)", iface.second.c_str(), iface.first);
+
+        struct nl_msg *msg = build_set_link_down_message(iface.first);
+        if (!msg)
+        {
+            SWSS_LOG_WARN("Failed to bring down old interface %s(%d), message alloc failed", iface.second.c_str(), iface.first);
+            continue;
+        }
+
+        err = nl_send_auto(sk, msg);
+        if (err < 0)
+        {
+            SWSS_LOG_WARN("Failed to bring down old interface %s(%d), error '%s'", iface.second.c_str(), iface.first, nl_geterror(err));
+        }
+        else
+        {
+            pending.emplace(nlmsg_hdr(msg)->nlmsg_seq, iface.first);
+        }
+        nlmsg_free(msg);
+
+        if (pending.size() >= SET_LINK_BATCH_SIZE)
+        {
+            recvSetLinkAcks(sk, pending);
+        }
+    }
+    recvSetLinkAcks(sk, pending);
+
+    nl_socket_free(sk);
+
+    auto msec = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+    SWSS_LOG_NOTICE("Brought down %zu old interfaces in %ld ms", m_ifindexOldNameMap.size(), static_cast<long>(msec));
+}
+
+void LinkSync::flush()
+{
+    m_statePipeline.flush();
+}
+
 void LinkSync::onMsg(int nlmsg_type, struct nl_object *obj)
 {
     SWSS_LOG_ENTER();
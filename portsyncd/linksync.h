@@ -3,6 +3,7 @@
 
 #include "dbconnector.h"
 #include "producerstatetable.h"
+#include "redispipeline.h"
 #include "netmsg.h"
 
 #include <map>
@@ -18,9 +19,18 @@ public:
 
     virtual void onMsg(int nlmsg_type, struct nl_object *obj);
 
+    /* Write the state of the links received since the last flush to STATE_DB */
+    void flush();
+
 private:
+    void bringDownOldIfaces();
+    void recvSetLinkAcks(struct nl_sock *sk, std::map<uint32_t, unsigned int> &pending);
+
     ProducerStateTable m_portTableProducer;
-    Table m_portTable, m_statePortTable, m_stateMgmtPortTable;
+    Table m_portTable;
+    /* STATE_DB updates are buffered and written once per netlink read batch */
+    RedisPipeline m_statePipeline;
+    Table m_statePortTable, m_stateMgmtPortTable;
 
     std::map<unsigned int, std::string> m_ifindexNameMap;
     std::map<unsigned int, std::string> m_ifindexOldNameMap;
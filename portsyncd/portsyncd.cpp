@@ -119,6 +119,9 @@ int main(int argc, char **argv)
 
             if (temps == static_cast<Selectable*>(&netlink))
             {
+                /* Write the state of the links of this netlink read batch */
+                sync.flush();
+
                 /* on netlink message, check if PortInitDone should be sent out */
                 if (!g_init && g_portSet.empty())
                 {
@@ -1,20 +1,35 @@
+#include <getopt.h>
+#include <time.h>
+
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <thread>
+#include <unordered_map>
 
 #include <dbconnector.h>
 #include <producerstatetable.h>
+#include <redispipeline.h>
 #include <schema.h>
 #include <tokenize.h>
 
 using namespace std;
 using namespace swss;
 
+#define DEFAULT_BATCH_SIZE 128
+
 static int line_index = 0;
 static DBConnector db("APPL_DB", 0, true);
+static RedisPipeline pipeline(&db);
+static unordered_map<string, unique_ptr<ProducerStateTable>> producers;
 
 void usage()
 {
-	cout << "Usage: swssplayer <file>" << endl;
+	cout << "Usage: swssplayer [-t] [-s <speed>] [-b <batch size>] <file>" << endl;
+	cout << "       -t: replay with the recorded timing" << endl;
+	cout << "       -s: speed multiplier of the timed replay (default 1.0)" << endl;
+	cout << "       -b: number of records flushed to the database in one batch (default " << DEFAULT_BATCH_SIZE << ")" << endl;
 	/* TODO: Add sample input file */
 }
 
@@ -34,46 +49,158 @@ vector<FieldValueTuple> processFieldsValuesTuple(string s)
 	return result;
 }
 
-void processTokens(vector<string> tokens)
+/*
+ * Parse the timestamp of a record, in format of YYYY-MM-DD.HH:MM:SS.uuuuuu,
+ * into microseconds. Return false if the timestamp can't be parsed.
+ */
+bool parseTimestamp(const string &timestamp, int64_t &usec)
+{
+	struct tm tm = {};
+	const char *rest = strptime(timestamp.c_str(), "%Y-%m-%d.%H:%M:%S", &tm);
+	if (rest == nullptr)
+	{
+		return false;
+	}
+
+	long fraction = 0;
+	if (*rest == '.')
+	{
+		fraction = strtol(rest + 1, nullptr, 10);
+	}
+
+	usec = static_cast<int64_t>(timegm(&tm)) * 1000000 + fraction;
+	return true;
+}
+
+ProducerStateTable &getProducer(const string &table_name)
+{
+	auto &producer = producers[table_name];
+	if (!producer)
+	{
+		producer = make_unique<ProducerStateTable>(&pipeline, table_name, true);
+	}
+
+	return *producer;
+}
+
+bool processTokens(vector<string> tokens)
 {
+	/* Skip lines without operations, like "recording started" */
+	if (tokens.size() < 3)
+	{
+		return false;
+	}
+
 	auto key = tokens[1];
 
 	/* Process the key */
 	auto v_key = tokenize(key, ':', 1);
+	if (v_key.size() < 2)
+	{
+		cerr << "Invalid key " << key << " at line " << line_index << endl;
+		return false;
+	}
 	auto table_name = v_key[0];
 	auto key_name = v_key[1];
 
-	ProducerStateTable producer(&db, table_name);
+	auto &producer = getProducer(table_name);
 
 	/* Process the operation */
 	auto op = tokens[2];
 	if (op == SET_COMMAND)
 	{
-		auto tuples = processFieldsValuesTuple(tokens[3]);
+		auto tuples = processFieldsValuesTuple(tokens.size() > 3 ? tokens[3] : "");
 		producer.set(key_name, tuples, SET_COMMAND);
 	}
 	else if (op == DEL_COMMAND)
 	{
 		producer.del(key_name, DEL_COMMAND);
 	}
+	else
+	{
+		return false;
+	}
+
+	return true;
 }
 
 int main(int argc, char **argv)
 {
-	if (argc != 2)
+	bool timed = false;
+	double speed = 1.0;
+	long batch_size = DEFAULT_BATCH_SIZE;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "ts:b:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 't':
+			timed = true;
+			break;
+		case 's':
+			speed = atof(optarg);
+			break;
+		case 'b':
+			batch_size = atol(optarg);
+			break;
+		default:
+			usage();
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (optind != argc - 1 || speed <= 0 || batch_size <= 0)
 	{
 		usage();
 		exit(EXIT_FAILURE);
 	}
 
-	ifstream file(argv[1]);
+	ifstream file(argv[optind]);
 	string line;
+	long pending = 0;
+	int64_t first_record_usec = -1;
+	auto replay_start = chrono::steady_clock::now();
 
 	while (getline(file, line))
 	{
 		auto tokens = tokenize(line, '|', 3);
-		processTokens(tokens);
+
+		/*
+		 * In the timed mode, the records are replayed at the recorded intervals
+		 * divided by the speed. Buffered records are flushed before waiting.
+		 */
+		int64_t record_usec;
+		if (timed && !tokens.empty() && parseTimestamp(tokens[0], record_usec))
+		{
+			if (first_record_usec < 0)
+			{
+				first_record_usec = record_usec;
+			}
+
+			auto offset = chrono::microseconds(static_cast<int64_t>((record_usec - first_record_usec) / speed));
+			auto due = replay_start + offset;
+			if (due > chrono::steady_clock::now())
+			{
+				if (pending > 0)
+				{
+					pipeline.flush();
+					pending = 0;
+				}
+				this_thread::sleep_until(due);
+			}
+		}
+
+		if (processTokens(tokens) && ++pending >= batch_size)
+		{
+			pipeline.flush();
+			pending = 0;
+		}
 
 		line_index++;
 	}
+
+	pipeline.flush();
+
+	return 0;
 }
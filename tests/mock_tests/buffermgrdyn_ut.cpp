@@ -177,8 +177,10 @@ namespace buffermgrdyn_test
                 TableConnector(m_config_db.get(), CFG_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME),
                 TableConnector(m_config_db.get(), CFG_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME),
                 TableConnector(m_config_db.get(), CFG_DEFAULT_LOSSLESS_BUFFER_PARAMETER),
+                TableConnector(m_config_db.get(), CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE_NAME),
                 TableConnector(m_state_db.get(), STATE_BUFFER_MAXIMUM_VALUE_TABLE),
-                TableConnector(m_state_db.get(), STATE_PORT_TABLE_NAME)
+                TableConnector(m_state_db.get(), STATE_PORT_TABLE_NAME),
+                TableConnector(m_state_db.get(), STATE_ASIC_TABLE_NAME)
             };
 
             m_dynamicBuffer = new BufferMgrDynamic(m_config_db.get(), m_state_db.get(), m_app_db.get(), m_app_state_db.get(), buffer_table_connectors, nullptr, zero_profile);
@@ -572,6 +574,79 @@ namespace buffermgrdyn_test
         CheckProfileList("Ethernet6", false, "egress_lossless_profile,egress_lossy_profile");
     }
 
+    /*
+     * Headroom cache flow
+     * 1. A dynamic profile whose parameters have been calculated takes the headroom from the cache
+     * 2. The cache is flushed when the default lossless parameter is updated
+     * 3. The statistics are exposed to STATE_DB on timer
+     */
+    TEST_F(BufferMgrDynTest, BufferMgrTestHeadroomCache)
+    {
+        vector<FieldValueTuple> fieldValues;
+        string value;
+
+        InitDefaultLosslessParameter();
+        InitMmuSize();
+
+        StartBufferManager();
+
+        InitPort();
+        SetPortInitDone();
+        m_dynamicBuffer->doTask(m_selectableTable);
+
+        InitBufferPool();
+        InitDefaultBufferProfile();
+
+        buffer_profile_t headroom;
+        headroom.speed = "100000";
+        headroom.cable_length = "5m";
+        headroom.port_mtu = "9100";
+        headroom.lane_count = m_dynamicBuffer->m_portInfoLookup["Ethernet0"].lane_count;
+        m_dynamicBuffer->m_headroomCache[m_dynamicBuffer->getHeadroomCacheKey(headroom)] = {"18432", "18432", "", "36864"};
+
+        InitCableLength("Ethernet0", "5m");
+        InitBufferPg("Ethernet0|3-4");
+
+        auto expectedProfile = "pg_lossless_100000_5m_profile";
+        CheckPg("Ethernet0", "Ethernet0:3-4", expectedProfile);
+        auto &profile = m_dynamicBuffer->m_bufferProfileLookup[expectedProfile];
+        ASSERT_EQ(profile.xon, "18432");
+        ASSERT_EQ(profile.xoff, "18432");
+        ASSERT_EQ(profile.size, "36864");
+        ASSERT_EQ(m_dynamicBuffer->m_headroomCacheHits, 1);
+        ASSERT_EQ(m_dynamicBuffer->m_headroomCacheInvalidations, 0);
+
+        InitDefaultLosslessParameter();
+        ASSERT_TRUE(m_dynamicBuffer->m_headroomCache.empty());
+        ASSERT_EQ(m_dynamicBuffer->m_headroomCacheInvalidations, 1);
+
+        m_dynamicBuffer->doTask(m_selectableTable);
+        Table stateHeadroomCacheTable(m_state_db.get(), STATE_BUFFER_HEADROOM_CACHE_TABLE);
+        ASSERT_TRUE(stateHeadroomCacheTable.hget("global", "hits", value));
+        ASSERT_EQ(value, "1");
+        ASSERT_TRUE(stateHeadroomCacheTable.hget("global", "invalidations", value));
+        ASSERT_EQ(value, "1");
+        ASSERT_TRUE(stateHeadroomCacheTable.hget("global", "entries", value));
+        ASSERT_EQ(value, "0");
+
+        // The traffic pattern and the ASIC parameters read by the plugin flush the cache too
+        m_dynamicBuffer->m_headroomCache[m_dynamicBuffer->getHeadroomCacheKey(headroom)] = {"18432", "18432", "", "36864"};
+        Table trafficPatternTable(m_config_db.get(), CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE_NAME);
+        trafficPatternTable.set("AZURE", { {"mtu", "1024"}, {"small_packet_percentage", "100"} });
+        m_dynamicBuffer->addExistingData(&trafficPatternTable);
+        static_cast<Orch *>(m_dynamicBuffer)->doTask();
+        ASSERT_TRUE(m_dynamicBuffer->m_headroomCache.empty());
+        ASSERT_EQ(m_dynamicBuffer->m_headroomCacheInvalidations, 2);
+
+        m_dynamicBuffer->m_headroomCache[m_dynamicBuffer->getHeadroomCacheKey(headroom)] = {"18432", "18432", "", "36864"};
+        Table asicTable(m_state_db.get(), STATE_ASIC_TABLE_NAME);
+        asicTable.set("MELLANOX-SPECTRUM-3", { {"cell_size", "144"}, {"pipeline_latency", "19"} });
+        m_dynamicBuffer->addExistingData(&asicTable);
+        static_cast<Orch *>(m_dynamicBuffer)->doTask();
+        ASSERT_TRUE(m_dynamicBuffer->m_headroomCache.empty());
+        ASSERT_EQ(m_dynamicBuffer->m_headroomCacheInvalidations, 3);
+    }
+
     /*
      * Verify a buffer pool will not be created without corresponding item in BUFFER_POOL
      * otherwise it interferes starting flow
@@ -173,4 +173,80 @@ namespace bulker_test
         // Confirm neighbor entry is pending removal
         ASSERT_TRUE(gNeighBulker.bulk_entry_pending_removal(neighbor_entry_remove));
     }
+
+    static vector<pair<sai_object_id_t, sai_object_id_t>> g_nhgm_sets;
+    static size_t g_nhgm_bulk_calls;
+
+    static sai_status_t mockSetNextHopGroupMembersAttribute(uint32_t object_count, const sai_object_id_t *object_id,
+                                                            const sai_attribute_t *attr_list, sai_bulk_op_error_mode_t mode,
+                                                            sai_status_t *object_statuses)
+    {
+        g_nhgm_bulk_calls++;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            g_nhgm_sets.emplace_back(object_id[i], attr_list[i].value.oid);
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    static sai_status_t mockSetNextHopGroupMemberAttribute(sai_object_id_t object_id, const sai_attribute_t *attr)
+    {
+        g_nhgm_sets.emplace_back(object_id, attr->value.oid);
+        return object_id == 0x3 ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+    }
+
+    TEST_F(BulkerTest, ObjectBulkerSet)
+    {
+        sai_next_hop_group_api_t nhg_api = {};
+        nhg_api.set_next_hop_group_members_attribute = mockSetNextHopGroupMembersAttribute;
+        nhg_api.set_next_hop_group_member_attribute = mockSetNextHopGroupMemberAttribute;
+
+        ObjectBulker<sai_next_hop_group_api_t> bulker(&nhg_api, 0x0, 1000);
+        deque<sai_status_t> object_statuses;
+        sai_attribute_t attr;
+        attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+
+        g_nhgm_sets.clear();
+        g_nhgm_bulk_calls = 0;
+
+        // The attributes of an object are set in order, one bulk call per attribute
+        attr.value.oid = 0x10;
+        object_statuses.emplace_back();
+        bulker.set_entry_attribute(&object_statuses.back(), 0x1, &attr);
+        attr.value.oid = 0x20;
+        object_statuses.emplace_back();
+        bulker.set_entry_attribute(&object_statuses.back(), 0x2, &attr);
+        attr.value.oid = 0x11;
+        object_statuses.emplace_back();
+        bulker.set_entry_attribute(&object_statuses.back(), 0x1, &attr);
+        ASSERT_EQ(bulker.setting_entries_count(), 2);
+        ASSERT_EQ(object_statuses[0], SAI_STATUS_NOT_EXECUTED);
+
+        bulker.flush();
+        ASSERT_EQ(g_nhgm_bulk_calls, 2);
+        ASSERT_EQ(g_nhgm_sets.size(), 3);
+        ASSERT_EQ(g_nhgm_sets.back(), (pair<sai_object_id_t, sai_object_id_t>(0x1, 0x11)));
+        ASSERT_EQ(bulker.setting_entries_count(), 0);
+        for (auto status : object_statuses)
+        {
+            ASSERT_EQ(status, SAI_STATUS_SUCCESS);
+        }
+
+        // Fall back to single sets when the SAI has no bulk set
+        nhg_api.set_next_hop_group_members_attribute = nullptr;
+        ObjectBulker<sai_next_hop_group_api_t> single_bulker(&nhg_api, 0x0, 1000);
+        g_nhgm_sets.clear();
+        object_statuses.clear();
+
+        object_statuses.emplace_back();
+        single_bulker.set_entry_attribute(&object_statuses.back(), 0x2, &attr);
+        object_statuses.emplace_back();
+        single_bulker.set_entry_attribute(&object_statuses.back(), 0x3, &attr);
+        single_bulker.flush();
+
+        ASSERT_EQ(g_nhgm_sets.size(), 2);
+        ASSERT_EQ(object_statuses[0], SAI_STATUS_SUCCESS);
+        ASSERT_EQ(object_statuses[1], SAI_STATUS_FAILURE);
+    }
 }
@@ -322,4 +322,45 @@ namespace consumer_test
         validate_syncmap(consumer->m_toSync, 1, key, exp_kofv);
 
     }
+
+    TEST_F(ConsumerTest, ConsumerRefillToSync_Threaded)
+    {
+        // Enough keys for several batches, read by more than one worker
+        size_t count = 2 * REFILL_BATCH_SIZE + 1;
+        Table table(m_config_db.get(), "CFG_TEST_TABLE");
+        for (size_t i = 0; i < count; i++)
+        {
+            table.set(key + to_string(i), { { f1, to_string(i) } });
+        }
+
+        RefillReader reader;
+        reader.add(consumer.get(), m_config_db.get(), "CFG_TEST_TABLE");
+        reader.start();
+        ASSERT_GT(reader.getWorkerCount(), 1u);
+        ASSERT_TRUE(reader.contains(consumer.get()));
+
+        ConsumerBase::setRefillReader(&reader);
+        size_t refilled = consumer->refillToSync();
+        ConsumerBase::setRefillReader(nullptr);
+
+        ASSERT_EQ(refilled, count);
+        ASSERT_EQ(consumer->getRefilledCount(), count);
+        ASSERT_FALSE(reader.contains(consumer.get()));
+
+        // Each entry is restored exactly once, with its own fields
+        ASSERT_EQ(consumer->m_toSync.size(), count);
+        for (size_t i = 0; i < count; i++)
+        {
+            auto range = consumer->m_toSync.equal_range(key + to_string(i));
+            ASSERT_EQ(distance(range.first, range.second), 1);
+            ASSERT_EQ(kfvOp(range.first->second), SET_COMMAND);
+            ASSERT_EQ(kfvFieldsValues(range.first->second), vector<FieldValueTuple>({ { f1, to_string(i) } }));
+        }
+
+        // Without a reader the table is read back by the consumer itself
+        consumer->m_toSync.clear();
+        ASSERT_EQ(consumer->refillToSync(), count);
+        ASSERT_EQ(consumer->m_toSync.size(), count);
+        ASSERT_EQ(consumer->getRefilledCount(), 2 * count);
+    }
 }
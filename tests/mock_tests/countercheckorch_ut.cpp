@@ -0,0 +1,91 @@
+#include "ut_helper.h"
+#include "mock_table.h"
+#define private public
+#include "countercheckorch.h"
+#undef private
+#include "sai_serialize.h"
+
+namespace countercheckorch_test
+{
+    using namespace std;
+
+    struct CounterCheckOrchTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_config_db;
+        shared_ptr<swss::DBConnector> m_counters_db;
+
+        void SetUp() override
+        {
+            ::testing_db::reset();
+
+            m_config_db = make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_counters_db = make_shared<swss::DBConnector>("COUNTERS_DB", 0);
+        }
+
+        void TearDown() override
+        {
+            ::testing_db::reset();
+        }
+    };
+
+    TEST_F(CounterCheckOrchTest, McQueueCounters)
+    {
+        auto &orch = CounterCheckOrch::getInstance(m_config_db.get());
+
+        Port port("Ethernet0", Port::PHY);
+        port.m_port_id = 0x1000000000001;
+        port.m_queue_ids = { 0x15000000000001, 0x15000000000002, 0x15000000000003, 0x15000000000004 };
+        port.m_pfc_bitmask = 0x18;
+
+        vector<string> queues;
+        for (const auto &queueId : port.m_queue_ids)
+        {
+            queues.push_back(sai_serialize_object_id(queueId));
+        }
+
+        Table queueTypeMap(m_counters_db.get(), COUNTERS_QUEUE_TYPE_MAP);
+        queueTypeMap.set("", { { queues[0], "SAI_QUEUE_TYPE_MULTICAST" },
+                               { queues[1], "SAI_QUEUE_TYPE_UNICAST" },
+                               { queues[2], "SAI_QUEUE_TYPE_MULTICAST" },
+                               { queues[3], "SAI_QUEUE_TYPE_MULTICAST" } });
+
+        // The third queue has no counters yet, the last one has no packet counter
+        Table countersTable(m_counters_db.get(), COUNTERS_TABLE);
+        countersTable.set(queues[0], { { "SAI_QUEUE_STAT_PACKETS", "10" } });
+        countersTable.set(queues[1], { { "SAI_QUEUE_STAT_PACKETS", "20" } });
+        countersTable.set(queues[3], { { "SAI_QUEUE_STAT_BYTES", "30" } });
+
+        orch.addPort(port);
+
+        // The unicast queue and the multicast queue without counters are skipped
+        auto counters = orch.m_mcCountersMap[port.m_port_id];
+        ASSERT_EQ(counters.size(), 2u);
+        ASSERT_EQ(counters[0], 10u);
+        ASSERT_EQ(counters[1], numeric_limits<uint64_t>::max());
+        ASSERT_EQ(orch.m_pfcMaskMap[port.m_port_id], 0x18);
+
+        // The queue types are not read again once known
+        for (const auto &queue : queues)
+        {
+            ASSERT_EQ(orch.m_mcQueueCache.count(queue), 1u);
+        }
+        queueTypeMap.del("");
+        countersTable.set(queues[2], { { "SAI_QUEUE_STAT_PACKETS", "40" } });
+
+        counters = orch.getQueueMcCounters(port);
+        ASSERT_EQ(counters.size(), 3u);
+        ASSERT_EQ(counters[0], 10u);
+        ASSERT_EQ(counters[1], 40u);
+
+        orch.updatePortPfc(port.m_port_id, 0x08);
+        ASSERT_EQ(orch.m_pfcMaskMap[port.m_port_id], 0x08);
+
+        orch.removePort(port);
+        ASSERT_EQ(orch.m_mcCountersMap.count(port.m_port_id), 0u);
+        ASSERT_EQ(orch.m_pfcMaskMap.count(port.m_port_id), 0u);
+        for (const auto &queue : queues)
+        {
+            ASSERT_EQ(orch.m_mcQueueCache.count(queue), 0u);
+        }
+    }
+}
@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""
+Record the results of the <type>_rates.lua flex counter plugins, for
+counterrate_ut.cpp to check the rates computed by CounterRateOrch against.
+
+The scripts are run with Lua 5.1, as embedded in Redis, against an in-memory
+COUNTERS_DB. As in Redis, the Lua numbers passed to HSET are stored with
+%.17g. The counters are random and the poll intervals jittered around the
+interval of the flex counter group, so that the rates are also checked when
+the measured interval is not the configured one.
+
+Needs the lupa module (pip install lupa). Run from this directory:
+
+    ./gen_lua_rates.py
+
+Each <type>_rates.txt has the smoothing factor, then per poll:
+    poll <interval in ms>
+    keys <oids given to the script>
+    counter <oid> <counter> <value>     COUNTERS:<oid>, missing counters are not listed
+    rate <key> <field> <value>          RATES:<oid> and RATES:<oid>:<type> after the poll
+"""
+
+import random
+
+import lupa.lua51
+
+
+class Redis:
+    def __init__(self):
+        self.hashes = {}
+
+    def call(self, command, *args):
+        if command == 'SELECT':
+            return 'OK'
+        if command == 'HGET':
+            return self.hashes.get(args[0], {}).get(args[1], False)
+        if command == 'HEXISTS':
+            return 1 if args[1] in self.hashes.get(args[0], {}) else 0
+        if command == 'HSET':
+            value = args[2]
+            if not isinstance(value, str):
+                value = '%.17g' % value
+            self.hashes.setdefault(args[0], {})[args[1]] = value
+            return 1
+        raise ValueError('Unsupported command ' + command)
+
+
+def run_script(redis, script, keys, interval):
+    lua = lupa.lua51.LuaRuntime()
+    lua.globals().redis = lua.table_from({'call': redis.call})
+    lua.globals().KEYS = lua.table_from(keys)
+    lua.globals().ARGV = lua.table_from(['2', 'COUNTERS', interval])
+    lua.execute(script)
+
+
+def record(name, counters, alpha, base_interval, oid_count, polls, seed, missing=None, skipped=None):
+    rng = random.Random(seed)
+    oids = ['oid:0x%x' % (0x1000000000000 + i) for i in range(oid_count)]
+    redis = Redis()
+    redis.hashes['RATES:' + name] = {name + '_ALPHA': alpha}
+
+    with open('../../../orchagent/' + name.lower() + '_rates.lua') as f:
+        script = f.read()
+
+    values = {}
+    lines = ['alpha ' + alpha]
+    for poll in range(polls):
+        for i, oid in enumerate(oids):
+            for counter in counters:
+                if (oid, counter) not in values:
+                    # Close to 2^63 for the last object, to exercise the double rounding
+                    values[oid, counter] = 2**63 + rng.randrange(1000) if i == oid_count - 1 else 0
+                values[oid, counter] += rng.randrange(100000000)
+            redis.hashes['COUNTERS:' + oid] = {c: str(values[oid, c]) for c in counters}
+
+        for oid, counter in (missing or {}).get(poll, []):
+            del redis.hashes['COUNTERS:' + oids[oid]][counter]
+
+        keys = [oid for i, oid in enumerate(oids) if i not in (skipped or {}).get(poll, [])]
+        interval = '%.3f' % (base_interval + rng.uniform(-0.05, 0.05) * base_interval) if poll % 4 else str(base_interval)
+        run_script(redis, script, keys, interval)
+
+        lines.append('poll ' + interval)
+        lines.append('keys ' + ' '.join(keys))
+        for oid in oids:
+            for counter, value in sorted(redis.hashes['COUNTERS:' + oid].items()):
+                lines.append('counter %s %s %s' % (oid, counter, value))
+        for oid in oids:
+            for key in ('RATES:' + oid, 'RATES:' + oid + ':' + name):
+                for field, value in sorted(redis.hashes.get(key, {}).items()):
+                    lines.append('rate %s %s %s' % (key, field, value))
+
+    with open(name.lower() + '_rates.txt', 'w') as f:
+        f.write('# Generated by gen_lua_rates.py from %s_rates.lua, do not edit\n' % name.lower())
+        f.write('\n'.join(lines) + '\n')
+
+
+PORT_COUNTERS = [
+    'SAI_PORT_STAT_IF_IN_UCAST_PKTS',
+    'SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS',
+    'SAI_PORT_STAT_IF_OUT_UCAST_PKTS',
+    'SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS',
+    'SAI_PORT_STAT_IF_IN_OCTETS',
+    'SAI_PORT_STAT_IF_OUT_OCTETS',
+]
+
+RIF_COUNTERS = [
+    'SAI_ROUTER_INTERFACE_STAT_IN_OCTETS',
+    'SAI_ROUTER_INTERFACE_STAT_IN_PACKETS',
+    'SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS',
+    'SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS',
+]
+
+TUNNEL_COUNTERS = [
+    'SAI_TUNNEL_STAT_IN_OCTETS',
+    'SAI_TUNNEL_STAT_IN_PACKETS',
+    'SAI_TUNNEL_STAT_OUT_OCTETS',
+    'SAI_TUNNEL_STAT_OUT_PACKETS',
+]
+
+TRAP_COUNTERS = [
+    'SAI_COUNTER_STAT_PACKETS',
+]
+
+if __name__ == '__main__':
+    # A port missing a counter is skipped until the counter is back
+    record('PORT', PORT_COUNTERS, '0.18', 1000, 8, 16, 1,
+           missing={poll: [(3, 'SAI_PORT_STAT_IF_OUT_OCTETS')] for poll in (5, 6, 7)})
+    record('RIF', RIF_COUNTERS, '0.3', 1000, 8, 10, 2)
+    # Missing tunnel counters are counted as 0
+    record('TUNNEL', TUNNEL_COUNTERS, '0.5', 10000, 8, 10, 3,
+           missing={4: [(1, 'SAI_TUNNEL_STAT_OUT_PACKETS')]})
+    # A trap removed from the name map for a poll
+    record('TRAP', TRAP_COUNTERS, '0.1', 10000, 12, 12, 4, skipped={8: [5]})
@@ -0,0 +1,348 @@
+#include "ut_helper.h"
+#include "mock_table.h"
+#include "schema.h"
+#include "counter_rate_engine.h"
+#define private public
+#include "counterrateorch.h"
+#undef private
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace counterrate_test
+{
+    using namespace std;
+    using namespace swss;
+
+    typedef map<string, map<string, string>> RedisHashes;
+
+    /*
+     * Results of the <type>_rates.lua plugins, recorded by
+     * counterrate/gen_lua_rates.py: the counters and the interval of each
+     * poll, with the RATES table written by the script.
+     */
+    struct LuaPoll
+    {
+        double interval;
+        vector<string> keys;
+        RedisHashes counters;
+        RedisHashes rates;
+    };
+
+    struct LuaRates
+    {
+        double alpha;
+        vector<LuaPoll> polls;
+    };
+
+    static LuaRates loadLuaRates(const string &type)
+    {
+        string path = "./counterrate/" + type + "_rates.txt";
+        ifstream file(path);
+        EXPECT_TRUE(file.is_open()) << path;
+
+        LuaRates lua = { 0, {} };
+        string line;
+        while (getline(file, line))
+        {
+            istringstream fields(line);
+            string tag, key, field, value;
+            fields >> tag;
+            if (tag == "alpha")
+            {
+                fields >> lua.alpha;
+            }
+            else if (tag == "poll")
+            {
+                lua.polls.emplace_back();
+                fields >> lua.polls.back().interval;
+            }
+            else if (tag == "keys")
+            {
+                while (fields >> key)
+                {
+                    lua.polls.back().keys.push_back(key);
+                }
+            }
+            else if (tag == "counter")
+            {
+                fields >> key >> field >> value;
+                lua.polls.back().counters["COUNTERS:" + key][field] = value;
+            }
+            else if (tag == "rate")
+            {
+                fields >> key >> field >> value;
+                lua.polls.back().rates[key][field] = value;
+            }
+        }
+
+        return lua;
+    }
+
+    static bool hget(RedisHashes &db, const string &key, const string &field, string &value)
+    {
+        auto hash = db.find(key);
+        if (hash == db.end() || hash->second.find(field) == hash->second.end())
+        {
+            return false;
+        }
+        value = hash->second[field];
+        return true;
+    }
+
+    /* Poll of CounterRateOrch: read the counters, update the engine and write the RATES table */
+    static void enginePoll(CounterRateEngine &engine, RedisHashes &db, const vector<string> &oids,
+                           double alpha, double delta)
+    {
+        const auto &spec = engine.getSpec();
+        size_t counterCount = spec.counters.size();
+        vector<uint64_t> counters(oids.size() * counterCount, 0);
+        vector<uint8_t> present(oids.size() * counterCount, 0);
+
+        for (size_t i = 0; i < oids.size(); i++)
+        {
+            for (size_t c = 0; c < counterCount; c++)
+            {
+                string value;
+                if (hget(db, "COUNTERS:" + oids[i], spec.counters[c], value))
+                {
+                    counters[i * counterCount + c] = strtoull(value.c_str(), nullptr, 10);
+                    present[i * counterCount + c] = 1;
+                }
+            }
+        }
+
+        vector<CounterRateUpdate> updates;
+        engine.update(oids, counters, present, alpha, delta, updates);
+
+        for (const auto &update : updates)
+        {
+            auto &r = db["RATES:" + update.oid];
+            for (size_t i = 0; i < update.rates.size(); i++)
+            {
+                r[spec.rates[i].name] = CounterRateEngine::formatRate(update.rates[i]);
+            }
+            for (size_t c = 0; c < update.last.size(); c++)
+            {
+                r[spec.counters[c] + "_last"] = to_string(update.last[c]);
+            }
+            if (update.stateChanged)
+            {
+                db["RATES:" + update.oid + ":" + spec.type][RATES_INIT_DONE_FIELD] =
+                    CounterRateEngine::stateToString(update.state);
+            }
+        }
+    }
+
+    /* Restore the objects in the engine from the RATES table, as CounterRateOrch does for new objects */
+    static void engineRestore(CounterRateEngine &engine, RedisHashes &db, const vector<string> &oids)
+    {
+        const auto &spec = engine.getSpec();
+        for (const auto &oid : oids)
+        {
+            string initDone, value;
+            hget(db, "RATES:" + oid + ":" + spec.type, RATES_INIT_DONE_FIELD, initDone);
+
+            vector<double> rates;
+            for (const auto &rate : spec.rates)
+            {
+                if (hget(db, "RATES:" + oid, rate.name, value))
+                {
+                    rates.push_back(strtod(value.c_str(), nullptr));
+                }
+            }
+            vector<uint64_t> last;
+            for (const auto &counter : spec.counters)
+            {
+                if (hget(db, "RATES:" + oid, counter + "_last", value))
+                {
+                    last.push_back(strtoull(value.c_str(), nullptr, 10));
+                }
+            }
+
+            engine.restore(oid, initDone, last, rates);
+        }
+    }
+
+    /* Poll the objects of the recorded poll and check the RATES table against the one of the script */
+    static void checkPoll(CounterRateEngine &engine, RedisHashes &native, const LuaRates &lua, size_t poll)
+    {
+        const auto &luaPoll = lua.polls[poll];
+        for (const auto &counters : luaPoll.counters)
+        {
+            native[counters.first] = counters.second;
+        }
+
+        enginePoll(engine, native, luaPoll.keys, lua.alpha, luaPoll.interval);
+
+        RedisHashes rates;
+        for (const auto &hash : native)
+        {
+            if (hash.first.compare(0, 10, "RATES:oid:") == 0)
+            {
+                rates.insert(hash);
+            }
+        }
+        ASSERT_EQ(rates, luaPoll.rates) << "poll " << poll;
+    }
+
+    TEST(CounterRateTest, PortRatesMatchLua)
+    {
+        auto lua = loadLuaRates("port");
+        ASSERT_FALSE(lua.polls.empty());
+
+        RedisHashes native;
+        CounterRateEngine engine(gPortRateSpec);
+        for (size_t poll = 0; poll < lua.polls.size(); poll++)
+        {
+            checkPoll(engine, native, lua, poll);
+        }
+
+        const auto &oid = lua.polls.back().keys[0];
+        ASSERT_EQ(native["RATES:" + oid + ":PORT"][RATES_INIT_DONE_FIELD], "DONE");
+        ASSERT_NE(native["RATES:" + oid]["RX_BPS"], "0");
+    }
+
+    TEST(CounterRateTest, RifRatesMatchLua)
+    {
+        auto lua = loadLuaRates("rif");
+        ASSERT_FALSE(lua.polls.empty());
+
+        RedisHashes native;
+        CounterRateEngine engine(gRifRateSpec);
+        for (size_t poll = 0; poll < lua.polls.size(); poll++)
+        {
+            checkPoll(engine, native, lua, poll);
+        }
+    }
+
+    TEST(CounterRateTest, TunnelRatesMatchLua)
+    {
+        auto lua = loadLuaRates("tunnel");
+        ASSERT_FALSE(lua.polls.empty());
+
+        RedisHashes native;
+        CounterRateEngine engine(gTunnelRateSpec);
+        for (size_t poll = 0; poll < lua.polls.size(); poll++)
+        {
+            checkPoll(engine, native, lua, poll);
+        }
+    }
+
+    TEST(CounterRateTest, RestoredTrapRatesMatchLua)
+    {
+        auto lua = loadLuaRates("trap");
+        ASSERT_GE(lua.polls.size(), 10u);
+
+        RedisHashes native;
+        auto engine = unique_ptr<CounterRateEngine>(new CounterRateEngine(gTrapRateSpec));
+        const auto oids = lua.polls[0].keys;
+        for (size_t poll = 0; poll < lua.polls.size(); poll++)
+        {
+            // Restart with the state saved in the RATES table
+            if (poll == 6)
+            {
+                engine = unique_ptr<CounterRateEngine>(new CounterRateEngine(gTrapRateSpec));
+                engineRestore(*engine, native, oids);
+            }
+
+            // Forget the object missing from the poll, then restore it when it's back
+            const auto &keys = lua.polls[poll].keys;
+            for (const auto &oid : oids)
+            {
+                bool polled = find(keys.begin(), keys.end(), oid) != keys.end();
+                if (!polled && engine->contains(oid))
+                {
+                    engine->remove(oid);
+                }
+                else if (polled && !engine->contains(oid))
+                {
+                    engineRestore(*engine, native, { oid });
+                }
+            }
+
+            checkPoll(*engine, native, lua, poll);
+            ASSERT_EQ(engine->size(), keys.size());
+        }
+    }
+
+    /* Poll of CounterRateOrch on the recorded counters, with the name map holding the polled objects */
+    static void checkOrchPoll(CounterRateOrch &orch, const LuaRates &lua, size_t poll)
+    {
+        const auto &luaPoll = lua.polls[poll];
+        auto db = orch.m_countersDb.get();
+
+        Table nameMap(db, COUNTERS_PORT_NAME_MAP);
+        Table countersTable(db, COUNTERS_TABLE);
+        vector<FieldValueTuple> names;
+        for (size_t i = 0; i < luaPoll.keys.size(); i++)
+        {
+            names.emplace_back("Ethernet" + to_string(i * 4), luaPoll.keys[i]);
+        }
+        nameMap.del("");
+        nameMap.set("", names);
+
+        for (const auto &counters : luaPoll.counters)
+        {
+            auto oid = counters.first.substr(sizeof("COUNTERS:") - 1);
+            countersTable.del(oid);
+            countersTable.set(oid, vector<FieldValueTuple>(counters.second.begin(), counters.second.end()));
+        }
+
+        auto group = orch.getGroup(luaPoll.keys[0]);
+        ASSERT_NE(group, nullptr);
+        ASSERT_EQ(group->getSpec().type, "PORT");
+        orch.updateRates(*group, luaPoll.interval);
+
+        Table ratesTable(db, RATES_TABLE_NAME);
+        vector<string> keys;
+        ratesTable.getKeys(keys);
+        RedisHashes rates;
+        for (const auto &key : keys)
+        {
+            if (key.compare(0, 4, "oid:") != 0)
+            {
+                continue;
+            }
+            vector<FieldValueTuple> fvs;
+            ratesTable.get(key, fvs);
+            rates["RATES:" + key] = map<string, string>(fvs.begin(), fvs.end());
+        }
+        ASSERT_EQ(rates, luaPoll.rates) << "poll " << poll;
+    }
+
+    TEST(CounterRateTest, OrchPortRatesMatchLua)
+    {
+        ::testing_db::reset();
+
+        auto lua = loadLuaRates("port");
+        ASSERT_FALSE(lua.polls.empty());
+
+        auto orch = unique_ptr<CounterRateOrch>(new CounterRateOrch());
+        Table(orch->m_countersDb.get(), RATES_TABLE_NAME).set("PORT", { { "PORT_ALPHA", to_string(lua.alpha) } });
+
+        for (size_t poll = 0; poll < lua.polls.size(); poll++)
+        {
+            // Restart with the state saved in the RATES table
+            if (poll == 6)
+            {
+                orch = unique_ptr<CounterRateOrch>(new CounterRateOrch());
+            }
+            checkOrchPoll(*orch, lua, poll);
+        }
+
+        // A port removed from the name map is forgotten
+        auto &group = *orch->getGroup(lua.polls.back().keys[0]);
+        const auto oid = lua.polls.back().keys.back();
+        ASSERT_TRUE(group.contains(oid));
+        Table nameMap(orch->m_countersDb.get(), COUNTERS_PORT_NAME_MAP);
+        nameMap.del("");
+        nameMap.set("", { { "Ethernet0", lua.polls.back().keys[0] } });
+        orch->updateRates(group, 1000);
+        ASSERT_FALSE(group.contains(oid));
+        ASSERT_EQ(group.size(), 1u);
+
+        ::testing_db::reset();
+    }
+}
@@ -0,0 +1,95 @@
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_table.h"
+
+extern CrmOrch *gCrmOrch;
+
+namespace crmorch_test
+{
+    using namespace std;
+
+    struct CrmOrchTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_config_db;
+        shared_ptr<swss::DBConnector> m_counters_db;
+        shared_ptr<swss::Table> m_countersCrmTable;
+
+        void SetUp() override
+        {
+            testing_db::reset();
+
+            m_config_db = make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_counters_db = make_shared<swss::DBConnector>("COUNTERS_DB", 0);
+            m_countersCrmTable = make_shared<swss::Table>(m_counters_db.get(), COUNTERS_CRM_TABLE);
+
+            ASSERT_EQ(gCrmOrch, nullptr);
+            gCrmOrch = new CrmOrch(m_config_db.get(), CFG_CRM_TABLE_NAME);
+        }
+
+        void TearDown() override
+        {
+            delete gCrmOrch;
+            gCrmOrch = nullptr;
+        }
+    };
+
+    TEST_F(CrmOrchTest, UsedCounters)
+    {
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        gCrmOrch->incCrmAclUsedCounter(CrmResourceType::CRM_ACL_TABLE, SAI_ACL_STAGE_INGRESS, SAI_ACL_BIND_POINT_TYPE_PORT);
+        gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, 0x7000000000001);
+
+        const auto &resourceMap = Portal::CrmOrchInternal::getResourceMap(gCrmOrch);
+        ASSERT_EQ(resourceMap.at(CrmResourceType::CRM_IPV4_ROUTE).countersMap.at("STATS").usedCounter, 1);
+        ASSERT_EQ(resourceMap.at(CrmResourceType::CRM_ACL_TABLE).countersMap.at("ACL_STATS:INGRESS:PORT").usedCounter, 1);
+        ASSERT_EQ(resourceMap.at(CrmResourceType::CRM_ACL_ENTRY).countersMap.at("ACL_TABLE_STATS:0x7000000000001").usedCounter, 1);
+        ASSERT_EQ(resourceMap.at(CrmResourceType::CRM_ACL_ENTRY).countersMap.at("ACL_TABLE_STATS:0x7000000000001").id, 0x7000000000001);
+        ASSERT_TRUE(Portal::CrmOrchInternal::getCrmAclKey(gCrmOrch, SAI_ACL_STAGE_INGRESS, SAI_ACL_BIND_POINT_TYPE_SWITCH) == "ACL_STATS:INGRESS:SWITCH");
+    }
+
+    /*
+     * Only the counters changed since the last poll are written to COUNTERS_DB
+     */
+    TEST_F(CrmOrchTest, UpdateChangedCountersOnly)
+    {
+        string value;
+
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+        Portal::CrmOrchInternal::updateCrmCountersTable(gCrmOrch);
+
+        ASSERT_TRUE(m_countersCrmTable->hget("STATS", "crm_stats_ipv4_route_used", value));
+        ASSERT_EQ(value, "1");
+        ASSERT_TRUE(m_countersCrmTable->hget("STATS", "crm_stats_ipv4_neighbor_used", value));
+        ASSERT_EQ(value, "1");
+
+        // Remove the published entry to detect which counters are written again
+        m_countersCrmTable->del("STATS");
+
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        Portal::CrmOrchInternal::updateCrmCountersTable(gCrmOrch);
+
+        ASSERT_TRUE(m_countersCrmTable->hget("STATS", "crm_stats_ipv4_route_used", value));
+        ASSERT_EQ(value, "2");
+        ASSERT_FALSE(m_countersCrmTable->hget("STATS", "crm_stats_ipv4_neighbor_used", value));
+
+        // Counters of a removed ACL table are published again once the table is re-created
+        sai_object_id_t tableId = 0x7000000000001;
+        gCrmOrch->incCrmAclUsedCounter(CrmResourceType::CRM_ACL_TABLE, SAI_ACL_STAGE_INGRESS, SAI_ACL_BIND_POINT_TYPE_PORT);
+        gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, tableId);
+        Portal::CrmOrchInternal::updateCrmCountersTable(gCrmOrch);
+        ASSERT_TRUE(m_countersCrmTable->hget("ACL_TABLE_STATS:0x7000000000001", "crm_stats_acl_entry_used", value));
+        ASSERT_EQ(value, "1");
+
+        gCrmOrch->decCrmAclUsedCounter(CrmResourceType::CRM_ACL_TABLE, SAI_ACL_STAGE_INGRESS, SAI_ACL_BIND_POINT_TYPE_PORT, tableId);
+        ASSERT_FALSE(m_countersCrmTable->hget("ACL_TABLE_STATS:0x7000000000001", "crm_stats_acl_entry_used", value));
+
+        gCrmOrch->incCrmAclUsedCounter(CrmResourceType::CRM_ACL_TABLE, SAI_ACL_STAGE_INGRESS, SAI_ACL_BIND_POINT_TYPE_PORT);
+        gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, tableId);
+        Portal::CrmOrchInternal::updateCrmCountersTable(gCrmOrch);
+        ASSERT_TRUE(m_countersCrmTable->hget("ACL_TABLE_STATS:0x7000000000001", "crm_stats_acl_entry_used", value));
+        ASSERT_EQ(value, "1");
+    }
+}
@@ -8,6 +8,8 @@
 #include "mock_orchagent_main.h"
 #include "mock_sai_api.h"
 #include "mock_orch_test.h"
+#include "mock_response_publisher.h"
+#include "zmqclient.h"
 #include "dash_api/appliance.pb.h"
 #include "dash_api/route_type.pb.h"
 #include "dash_api/eni.pb.h"
@@ -17,6 +19,8 @@
 
 EXTERN_MOCK_FNS
 
+extern std::unique_ptr<MockResponsePublisher> gMockResponsePublisher;
+
 namespace dashorch_test
 {
     using namespace mock_orch_test;
@@ -52,4 +56,35 @@ namespace dashorch_test
         bool success = m_DashOrch->removeRoutingTypeEntry(dash::route_type::RoutingType::ROUTING_TYPE_DROP);
         EXPECT_TRUE(success);
     }
-}
\ No newline at end of file
+
+    TEST_F(DashOrchTest, ProcessedEntriesAreResponded)
+    {
+        gMockResponsePublisher = std::make_unique<MockResponsePublisher>();
+
+        dash::route_type::RouteType route_type;
+        route_type.add_items()->set_action_type(dash::route_type::ActionType::ACTION_TYPE_STATICENCAP);
+        std::vector<FieldValueTuple> fvs = { { "pb", route_type.SerializeAsString() } };
+
+        auto consumer = dynamic_cast<ConsumerBase *>(m_DashOrch->getExecutor(APP_DASH_ROUTING_TYPE_TABLE_NAME));
+        ASSERT_NE(consumer, nullptr);
+
+        // No response without a ZMQ client
+        EXPECT_CALL(*gMockResponsePublisher, publish(::testing::_, ::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(0);
+        consumer->addToSync({ { "vnet", SET_COMMAND, fvs } });
+        m_DashOrch->doTaskAndRespond(*consumer);
+        ASSERT_TRUE(consumer->m_toSync.empty());
+        ::testing::Mock::VerifyAndClearExpectations(gMockResponsePublisher.get());
+
+        swss::ZmqClient zmqClient("tcp://127.0.0.1:8130");
+        m_DashOrch->setResponseZmqClient(&zmqClient);
+
+        EXPECT_CALL(*gMockResponsePublisher, publish(APP_DASH_ROUTING_TYPE_TABLE_NAME, "direct", fvs, ReturnCode(), false)).Times(1);
+        EXPECT_CALL(*gMockResponsePublisher, publish(APP_DASH_ROUTING_TYPE_TABLE_NAME, "vnet", std::vector<FieldValueTuple>{}, ReturnCode(), false)).Times(1);
+        consumer->addToSync({ { "direct", SET_COMMAND, fvs }, { "vnet", DEL_COMMAND, {} } });
+        m_DashOrch->doTaskAndRespond(*consumer);
+        ASSERT_TRUE(consumer->m_toSync.empty());
+
+        m_DashOrch->setResponseZmqClient(nullptr);
+        gMockResponsePublisher.reset();
+    }
+}
@@ -44,3 +44,5 @@ void ResponsePublisher::writeToDB(
 void ResponsePublisher::flush() {}
 
 void ResponsePublisher::setBuffered(bool buffered) {}
+
+void ResponsePublisher::setZmqClient(swss::ZmqClient *zmqClient, bool dbPersistence) {}
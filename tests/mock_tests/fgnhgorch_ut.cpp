@@ -0,0 +1,72 @@
+#define private public
+#include "directory.h"
+#include "fgnhgorch.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+
+#include <algorithm>
+
+namespace fgnhgorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    class FgNhgOrchTest : public MockOrchTest
+    {
+    };
+
+    static vector<pair<sai_object_id_t, sai_object_id_t>> g_nhgm_sets;
+    static size_t g_nhgm_bulk_calls;
+
+    static sai_status_t mockSetNextHopGroupMembersAttribute(uint32_t object_count, const sai_object_id_t *object_id,
+                                                            const sai_attribute_t *attr_list, sai_bulk_op_error_mode_t mode,
+                                                            sai_status_t *object_statuses)
+    {
+        g_nhgm_bulk_calls++;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            g_nhgm_sets.emplace_back(object_id[i], attr_list[i].value.oid);
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    TEST_F(FgNhgOrchTest, HashBucketChangesAreSetInBulk)
+    {
+        auto &bulker = gFgNhgOrch->m_nhgMemberBulker;
+        auto set_entries_attribute = bulker.set_entries_attribute;
+        bulker.set_entries_attribute = mockSetNextHopGroupMembersAttribute;
+        g_nhgm_sets.clear();
+        g_nhgm_bulk_calls = 0;
+
+        IpPrefix ipPrefix("2.2.2.0/24");
+        NextHopKey nh1("10.0.0.1", "Ethernet0");
+        NextHopKey nh2("10.0.0.2", "Ethernet4");
+
+        FGNextHopGroupEntry entry;
+        entry.nhopgroup_members = { 0x2d0001, 0x2d0002, 0x2d0003 };
+
+        // Bucket 0 is rewritten twice, it is set once to its last next hop
+        gFgNhgOrch->writeHashBucketChange(&entry, 0, 0x40001, ipPrefix, nh1);
+        gFgNhgOrch->writeHashBucketChange(&entry, 2, 0x40001, ipPrefix, nh1);
+        gFgNhgOrch->writeHashBucketChange(&entry, 0, 0x40002, ipPrefix, nh2);
+        ASSERT_EQ(g_nhgm_bulk_calls, 0u);
+
+        ASSERT_TRUE(gFgNhgOrch->flushHashBucketChanges(&entry, ipPrefix));
+        ASSERT_EQ(g_nhgm_bulk_calls, 1u);
+        sort(g_nhgm_sets.begin(), g_nhgm_sets.end());
+        ASSERT_EQ(g_nhgm_sets, (vector<pair<sai_object_id_t, sai_object_id_t>>({ { 0x2d0001, 0x40002 }, { 0x2d0003, 0x40001 } })));
+        ASSERT_TRUE(gFgNhgOrch->m_hashBucketChanges.empty());
+
+        // Nothing is set without pending rewrites
+        ASSERT_TRUE(gFgNhgOrch->flushHashBucketChanges(&entry, ipPrefix));
+        ASSERT_EQ(g_nhgm_bulk_calls, 1u);
+
+        bulker.set_entries_attribute = set_entries_attribute;
+    }
+}
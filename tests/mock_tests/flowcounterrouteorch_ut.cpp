@@ -1,5 +1,6 @@
 #define private public
 #include "directory.h"
+#include "flowcounterrouteorch.h"
 #undef private
 #define protected public
 #include "orch.h"
@@ -368,6 +369,45 @@ namespace flowcounterrouteorch_test
 
     }
 
+    TEST_F(FlowcounterRouteOrchTest, BoundRoutesInPrefixOrder)
+    {
+        // More matching routes than the pattern allows
+        Table routeTable = Table(m_app_db.get(), APP_ROUTE_TABLE_NAME);
+        for (int i = 2; i <= 32; i++)
+        {
+            routeTable.set("2.2.2." + to_string(i) + "/32", { {"ifname", "Ethernet0" },
+                                                             {"nexthop", "10.0.0.2" }});
+        }
+        gRouteOrch->addExistingData(&routeTable);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"2.2.2.0/24", "SET", { {"max_match_count", "3"}}});
+        auto consumer = dynamic_cast<Consumer *>(gFlowCounterRouteOrch->getExecutor(CFG_FLOW_COUNTER_ROUTE_PATTERN_TABLE_NAME));
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gFlowCounterRouteOrch)->doTask();
+
+        // The lowest prefixes are bound, whatever the order of the route table
+        set<IpPrefix> bound;
+        for (const auto &cache : { gFlowCounterRouteOrch->mBoundRouteCounters, gFlowCounterRouteOrch->mPendingAddToFlexCntr })
+        {
+            for (const auto &pattern : cache)
+            {
+                for (const auto &route : pattern.second)
+                {
+                    bound.insert(route.first);
+                }
+            }
+        }
+        set<IpPrefix> expected = { IpPrefix("2.2.2.2/32"), IpPrefix("2.2.2.3/32"), IpPrefix("2.2.2.4/32") };
+        ASSERT_EQ(bound, expected);
+
+        entries.clear();
+        entries.push_back({"2.2.2.0/24", "DEL", {}});
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gFlowCounterRouteOrch)->doTask();
+    }
+
     TEST_F(FlowcounterRouteOrchTest, DelayAddVRF)
     {
         std::deque<KeyOpFieldsValuesTuple> entries;
@@ -17,6 +17,7 @@ int32_t gVoqMySwitchId = 0;
 string gMyHostName = "Linecard1";
 string gMyAsicName = "Asic0";
 bool gTraditionalFlexCounter = false;
+bool gCounterRatesInOrch = false;
 
 VRFOrch *gVrfOrch;
 
@@ -0,0 +1,293 @@
+#include "gtest/gtest.h"
+#include <net/if.h>
+#include <arpa/inet.h>
+#include <linux/rtnetlink.h>
+#include <netlink/netlink.h>
+#include <netlink/msg.h>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include "../mock_table.h"
+#define protected public
+#include "orch.h"
+#undef protected
+#define private public
+#include "nbrmgr.h"
+#undef private
+
+extern int (*callback)(const std::string &cmd, std::string &stdout);
+extern std::vector<std::string> mockCallArgs;
+
+#define INBAND_IFNAME   "Ethernet-IB0"
+#define INBAND_IFINDEX  42
+
+/* Route requests sent by NbrMgr on its netlink socket */
+struct FakeRouteRequest
+{
+    uint16_t type;
+    std::string dst;
+    uint32_t oif;
+    uint32_t priority;
+};
+
+std::vector<FakeRouteRequest> g_routeRequests;
+std::set<std::string> g_kernelRoutes;
+size_t g_neighRequests = 0;
+std::vector<uint8_t> g_acks;
+
+static void queueAck(const struct nlmsghdr *hdr, int error)
+{
+    struct nlmsghdr ack_hdr;
+    struct nlmsgerr err;
+
+    memset(&ack_hdr, 0, sizeof(ack_hdr));
+    ack_hdr.nlmsg_len = static_cast<uint32_t>(NLMSG_LENGTH(sizeof(err)));
+    ack_hdr.nlmsg_type = NLMSG_ERROR;
+    ack_hdr.nlmsg_seq = hdr->nlmsg_seq;
+
+    err.error = error;
+    err.msg = *hdr;
+
+    auto ack_hdr_bytes = reinterpret_cast<uint8_t *>(&ack_hdr);
+    auto err_bytes = reinterpret_cast<uint8_t *>(&err);
+    g_acks.insert(g_acks.end(), ack_hdr_bytes, ack_hdr_bytes + NLMSG_HDRLEN);
+    g_acks.insert(g_acks.end(), err_bytes, err_bytes + NLMSG_ALIGN(sizeof(err)));
+}
+
+/* Mock the netlink socket of NbrMgr, the routes are programmed in g_kernelRoutes */
+extern "C" {
+    unsigned int __wrap_if_nametoindex(const char *ifname)
+    {
+        return std::string(ifname) == INBAND_IFNAME ? INBAND_IFINDEX : 0;
+    }
+
+    int nl_send_auto(struct nl_sock *sk, struct nl_msg *msg)
+    {
+        nl_complete_msg(sk, msg);
+        struct nlmsghdr *hdr = nlmsg_hdr(msg);
+        int error = 0;
+
+        if (hdr->nlmsg_type == RTM_NEWROUTE || hdr->nlmsg_type == RTM_DELROUTE)
+        {
+            struct rtmsg *rtm = static_cast<struct rtmsg *>(nlmsg_data(hdr));
+            struct nlattr *tb[RTA_MAX + 1];
+            nlmsg_parse(hdr, sizeof(struct rtmsg), tb, RTA_MAX, nullptr);
+
+            FakeRouteRequest request = { hdr->nlmsg_type, "", 0, 0 };
+            char dst[INET6_ADDRSTRLEN];
+            inet_ntop(rtm->rtm_family, nla_data(tb[RTA_DST]), dst, sizeof(dst));
+            request.dst = std::string(dst) + "/" + std::to_string(rtm->rtm_dst_len);
+            if (tb[RTA_OIF])
+            {
+                request.oif = nla_get_u32(tb[RTA_OIF]);
+            }
+            if (tb[RTA_PRIORITY])
+            {
+                request.priority = nla_get_u32(tb[RTA_PRIORITY]);
+            }
+            g_routeRequests.push_back(request);
+
+            if (hdr->nlmsg_type == RTM_NEWROUTE)
+            {
+                error = g_kernelRoutes.insert(request.dst).second ? 0 : -EEXIST;
+            }
+            else
+            {
+                error = g_kernelRoutes.erase(request.dst) ? 0 : -ESRCH;
+            }
+        }
+        else
+        {
+            g_neighRequests++;
+        }
+
+        queueAck(hdr, error);
+        return static_cast<int>(hdr->nlmsg_len);
+    }
+
+    int nl_recv(struct nl_sock *sk, struct sockaddr_nl *nla, unsigned char **buf, struct ucred **creds)
+    {
+        int len = static_cast<int>(g_acks.size());
+        *buf = static_cast<unsigned char *>(malloc(g_acks.size()));
+        memcpy(*buf, g_acks.data(), g_acks.size());
+        g_acks.clear();
+        return len;
+    }
+}
+
+int cb(const std::string &cmd, std::string &stdout)
+{
+    mockCallArgs.push_back(cmd);
+    return 0;
+}
+
+namespace nbrmgr_ut
+{
+    using namespace std;
+
+    struct NbrMgrTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_config_db;
+        shared_ptr<swss::DBConnector> m_app_db;
+        shared_ptr<swss::DBConnector> m_state_db;
+        vector<string> cfg_nbr_tables;
+
+        virtual void SetUp() override
+        {
+            testing_db::reset();
+            m_config_db = make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_app_db = make_shared<swss::DBConnector>("APPL_DB", 0);
+            m_state_db = make_shared<swss::DBConnector>("STATE_DB", 0);
+
+            swss::Table metadata_table = swss::Table(m_config_db.get(), CFG_DEVICE_METADATA_TABLE_NAME);
+            metadata_table.set("localhost", { { "switch_type", "voq" } });
+
+            swss::Table inband_table = swss::Table(m_config_db.get(), CFG_VOQ_INBAND_INTERFACE_TABLE_NAME);
+            inband_table.set(INBAND_IFNAME, { { "inband_type", "port" } });
+
+            swss::Table port_table = swss::Table(m_state_db.get(), STATE_PORT_TABLE_NAME);
+            port_table.set(INBAND_IFNAME, { { "netdev_oper_status", "up" } });
+
+            cfg_nbr_tables = { CFG_NEIGH_TABLE_NAME };
+
+            g_routeRequests.clear();
+            g_kernelRoutes.clear();
+            g_neighRequests = 0;
+            g_acks.clear();
+            mockCallArgs.clear();
+            callback = cb;
+        }
+
+        void doSystemNeighTask(swss::NbrMgr &nbrmgr, deque<KeyOpFieldsValuesTuple> &entries)
+        {
+            auto consumer = dynamic_cast<Consumer *>(nbrmgr.getExecutor(STATE_SYSTEM_NEIGH_TABLE_NAME));
+            consumer->addToSync(entries);
+            entries.clear();
+            nbrmgr.doTask();
+        }
+
+        size_t pendingSystemNeighs(swss::NbrMgr &nbrmgr)
+        {
+            auto consumer = dynamic_cast<Consumer *>(nbrmgr.getExecutor(STATE_SYSTEM_NEIGH_TABLE_NAME));
+            return consumer->m_toSync.size();
+        }
+
+        size_t countCommands(const string &pattern)
+        {
+            return count_if(mockCallArgs.begin(), mockCallArgs.end(),
+                            [&](const string &cmd) { return cmd.find(pattern) != string::npos; });
+        }
+    };
+
+    TEST_F(NbrMgrTest, AddSystemNeighRoutes)
+    {
+        swss::NbrMgr nbrmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_nbr_tables);
+
+        // Resolve request whose ack is never read by NbrMgr
+        nbrmgr.setNeighbor(INBAND_IFNAME, swss::IpAddress("10.0.0.100"), swss::MacAddress());
+        ASSERT_EQ(g_neighRequests, 1);
+
+        deque<KeyOpFieldsValuesTuple> entries = {
+            { "Linecard1|Asic0|Ethernet0|10.0.0.1", SET_COMMAND, { { "neigh", "00:01:02:03:04:05" } } },
+            { "Linecard1|Asic0|Ethernet4|10.0.0.2", SET_COMMAND, { { "neigh", "00:01:02:03:04:06" } } },
+            { "Linecard1|Asic0|Ethernet8|fc00::1", SET_COMMAND, { { "neigh", "00:01:02:03:04:07" } } }
+        };
+        doSystemNeighTask(nbrmgr, entries);
+
+        ASSERT_EQ(pendingSystemNeighs(nbrmgr), 0);
+        ASSERT_EQ(countCommands(" neigh add "), 3);
+        ASSERT_EQ(countCommands(" route "), 0);
+
+        ASSERT_EQ(g_routeRequests.size(), 3);
+        for (const auto &request : g_routeRequests)
+        {
+            ASSERT_EQ(request.type, RTM_NEWROUTE);
+            ASSERT_EQ(request.oif, INBAND_IFINDEX);
+        }
+        ASSERT_EQ(g_routeRequests[0].priority, 0);
+        ASSERT_EQ(g_routeRequests[2].priority, 256);
+        ASSERT_EQ(g_kernelRoutes, set<string>({ "10.0.0.1/32", "10.0.0.2/32", "fc00::1/128" }));
+    }
+
+    TEST_F(NbrMgrTest, RetrySystemNeighRouteAddFailure)
+    {
+        swss::NbrMgr nbrmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_nbr_tables);
+
+        // Route left over by the previous MAC of the neighbor
+        g_kernelRoutes.insert("10.0.0.2/32");
+
+        deque<KeyOpFieldsValuesTuple> entries = {
+            { "Linecard1|Asic0|Ethernet0|10.0.0.1", SET_COMMAND, { { "neigh", "00:01:02:03:04:05" } } },
+            { "Linecard1|Asic0|Ethernet4|10.0.0.2", SET_COMMAND, { { "neigh", "00:01:02:03:04:06" } } }
+        };
+        doSystemNeighTask(nbrmgr, entries);
+
+        // The neighbor and route of the failed entry are removed and the entry is retried
+        ASSERT_EQ(pendingSystemNeighs(nbrmgr), 1);
+        ASSERT_EQ(countCommands("neigh del 10.0.0.2"), 1);
+        ASSERT_EQ(g_kernelRoutes, set<string>({ "10.0.0.1/32" }));
+
+        nbrmgr.doTask();
+        ASSERT_EQ(pendingSystemNeighs(nbrmgr), 0);
+        ASSERT_EQ(g_kernelRoutes, set<string>({ "10.0.0.1/32", "10.0.0.2/32" }));
+    }
+
+    TEST_F(NbrMgrTest, DelSystemNeighRoutes)
+    {
+        swss::NbrMgr nbrmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_nbr_tables);
+
+        deque<KeyOpFieldsValuesTuple> entries = {
+            { "Linecard1|Asic0|Ethernet0|10.0.0.1", SET_COMMAND, { { "neigh", "00:01:02:03:04:05" } } },
+            { "Linecard1|Asic0|Ethernet8|fc00::1", SET_COMMAND, { { "neigh", "00:01:02:03:04:07" } } }
+        };
+        doSystemNeighTask(nbrmgr, entries);
+        ASSERT_EQ(g_kernelRoutes.size(), 2);
+
+        g_routeRequests.clear();
+        entries = {
+            { "Linecard1|Asic0|Ethernet0|10.0.0.1", DEL_COMMAND, { } },
+            { "Linecard1|Asic0|Ethernet8|fc00::1", DEL_COMMAND, { } },
+            { "Linecard1|Asic0|Ethernet4|10.0.0.2", DEL_COMMAND, { } }
+        };
+        doSystemNeighTask(nbrmgr, entries);
+
+        ASSERT_EQ(pendingSystemNeighs(nbrmgr), 0);
+        ASSERT_EQ(countCommands(" neigh del "), 3);
+        ASSERT_EQ(g_routeRequests.size(), 3);
+        for (const auto &request : g_routeRequests)
+        {
+            ASSERT_EQ(request.type, RTM_DELROUTE);
+        }
+        ASSERT_TRUE(g_kernelRoutes.empty());
+    }
+
+    /*
+     * Bring up of the remote system neighbors of a VOQ chassis. The number of
+     * neighbors can be changed with NBRMGR_PERF_NEIGHBORS (default 10000).
+     */
+    TEST_F(NbrMgrTest, RemoteNeighborBringUpPerf)
+    {
+        const char *scale = getenv("NBRMGR_PERF_NEIGHBORS");
+        size_t neighbors = (scale && *scale) ? strtoul(scale, nullptr, 10) : 10000;
+
+        swss::NbrMgr nbrmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_nbr_tables);
+
+        deque<KeyOpFieldsValuesTuple> entries;
+        for (size_t i = 0; i < neighbors; i++)
+        {
+            string ip = "10." + to_string((i >> 16) & 0xff) + "." + to_string((i >> 8) & 0xff) + "." + to_string(i & 0xff);
+            entries.push_back({ "Linecard1|Asic0|Ethernet0|" + ip, SET_COMMAND, { { "neigh", "00:01:02:03:04:05" } } });
+        }
+
+        auto start = chrono::steady_clock::now();
+        doSystemNeighTask(nbrmgr, entries);
+        auto usec = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+        cout << "Remote neighbor bring up: " << neighbors << " neighbors in " << usec / 1000 << " ms, "
+             << mockCallArgs.size() << " commands executed, " << g_routeRequests.size() << " route requests" << endl;
+
+        ASSERT_EQ(pendingSystemNeighs(nbrmgr), 0);
+        ASSERT_EQ(g_kernelRoutes.size(), neighbors);
+        ASSERT_EQ(countCommands(" route "), 0);
+    }
+}
@@ -0,0 +1,770 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "notifier.h"
+#include "json.h"
+#include "sai_serialize.h"
+#include "tokenize.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+/*
+ * End-to-end convergence benchmark of orchagent.
+ *
+ * Workloads are fed through the real RouteOrch, NeighOrch, AclOrch and
+ * PortsOrch consumers on top of libsaivs, so that the measured time covers
+ * the whole orchagent processing path down to the SAI API. The default scale
+ * is kept small so that the benchmark runs as a regular unit test. It can be
+ * scaled up with the following environment variables:
+ *
+ *   ORCHAGENT_PERF_ROUTES       number of routes (default 1000)
+ *   ORCHAGENT_PERF_NEIGHBORS    number of neighbors (default 500)
+ *   ORCHAGENT_PERF_ACL_RULES    number of ACL rules (default 200)
+ *   ORCHAGENT_PERF_OBSERVERS    number of route next hop observers (default 200)
+ *   ORCHAGENT_PERF_PORT_FLAPS   oper status flaps per port in the flap storm (default 10)
+ *   ORCHAGENT_PERF_VNET_ENDPOINTS  BFD monitored VNET tunnel endpoints (default 64)
+ *   ORCHAGENT_PERF_VNET_ROUTES  VNET tunnel routes over the endpoints (default 256)
+ *   ORCHAGENT_PERF_ECMP_WIDTH   next hops per ECMP route (default 4)
+ *   ORCHAGENT_PERF_ECMP_ROUNDS  rounds of ECMP member churn (default 5)
+ *   ORCHAGENT_PERF_BATCH        entries per doTask batch (default 128)
+ *   ORCHAGENT_PERF_RECORD       swss.rec file to replay instead of synthetic entries
+ *
+ * e.g. ORCHAGENT_PERF_ROUTES=100000 ./tests --gtest_filter=OrchagentPerfTest.*
+ */
+
+extern redisReply *mockReply;
+
+namespace orchagent_perf_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    static const vector<string> PERF_INTERFACES = { ETHERNET0, ETHERNET4, ETHERNET8, ETHERNET12 };
+    static const string PERF_ACL_TABLE = "PERF_ACL";
+    /* Neighbors configured before the workloads run, used as route next hops */
+    static const size_t NEXTHOPS_PER_INTERFACE = 4;
+
+    static size_t getScale(const char *name, size_t default_value)
+    {
+        const char *value = getenv(name);
+        if (value == nullptr || *value == '\0')
+        {
+            return default_value;
+        }
+
+        return static_cast<size_t>(strtoul(value, nullptr, 10));
+    }
+
+    /* Peak resident set size of the process in KB */
+    static long getPeakRss()
+    {
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return -1;
+        }
+
+        return usage.ru_maxrss;
+    }
+
+    /* Host address in the /16 subnet of the interface with the given index */
+    static string getHostIp(size_t intf_index, size_t host)
+    {
+        return "10." + to_string(intf_index) + "." + to_string((host >> 8) & 0xff) + "." + to_string(host & 0xff);
+    }
+
+    static string getMac(size_t intf_index, size_t host)
+    {
+        char mac[18];
+        snprintf(mac, sizeof(mac), "00:00:%02zx:%02zx:%02zx:%02zx",
+                 intf_index & 0xff, (host >> 16) & 0xff, (host >> 8) & 0xff, host & 0xff);
+        return mac;
+    }
+
+    static string getRoutePrefix(size_t index)
+    {
+        return to_string(20 + (index >> 16)) + "." + to_string((index >> 8) & 0xff) + "." + to_string(index & 0xff) + ".0/24";
+    }
+
+    /* VNET tunnel endpoint and the address monitoring it by BFD */
+    static string getVnetEndpoint(size_t index, bool monitor)
+    {
+        return string(monitor ? "101." : "100.") + to_string((index >> 16) & 0xff) + "." +
+               to_string((index >> 8) & 0xff) + "." + to_string(index & 0xff);
+    }
+
+    /* Next hop observer remembering the route of its last update */
+    class PerfNextHopObserver : public Observer
+    {
+    public:
+        IpPrefix prefix;
+        size_t updates = 0;
+
+        void update(SubjectType type, void *cntx) override
+        {
+            if (type == SUBJECT_TYPE_NEXTHOP_CHANGE)
+            {
+                prefix = static_cast<NextHopUpdate *>(cntx)->prefix;
+                updates++;
+            }
+        }
+    };
+
+    struct PerfResult
+    {
+        string name;
+        size_t entries = 0;
+        size_t pending = 0;
+        double total_usec = 0;
+        /* Per entry latency amortized over the batch the entry was processed in */
+        vector<double> latencies;
+
+        double percentile(double p) const
+        {
+            if (latencies.empty())
+            {
+                return 0;
+            }
+
+            vector<double> sorted(latencies);
+            sort(sorted.begin(), sorted.end());
+            size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+            return sorted[index];
+        }
+
+        void report() const
+        {
+            double throughput = total_usec > 0 ? static_cast<double>(entries) * 1000000 / total_usec : 0;
+
+            cout << "[ PERF     ] " << left << setw(12) << name << right << fixed << setprecision(3)
+                 << " entries " << entries
+                 << " time " << total_usec / 1000 << " ms"
+                 << " throughput " << setprecision(0) << throughput << "/s" << setprecision(3)
+                 << " p50 " << percentile(0.5) << " us"
+                 << " p99 " << percentile(0.99) << " us"
+                 << " pending " << pending
+                 << " peak_rss " << getPeakRss() << " KB" << endl;
+        }
+    };
+
+    class OrchagentPerfTest : public MockOrchTest
+    {
+    protected:
+        size_t m_batchSize;
+
+        void ApplyInitialConfigs() override
+        {
+            m_batchSize = max<size_t>(getScale("ORCHAGENT_PERF_BATCH", 128), 1);
+
+            Table port_table = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+            Table intf_table = Table(m_app_db.get(), APP_INTF_TABLE_NAME);
+            Table neigh_table = Table(m_app_db.get(), APP_NEIGH_TABLE_NAME);
+
+            auto ports = ut_helper::getInitialSaiPorts();
+            for (const auto &it : ports)
+            {
+                port_table.set(it.first, it.second);
+            }
+            port_table.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+            gPortsOrch->addExistingData(&port_table);
+            static_cast<Orch *>(gPortsOrch)->doTask();
+
+            port_table.set("PortInitDone", { { "lanes", "0" } });
+            gPortsOrch->addExistingData(&port_table);
+            static_cast<Orch *>(gPortsOrch)->doTask();
+
+            for (size_t i = 0; i < PERF_INTERFACES.size(); i++)
+            {
+                intf_table.set(PERF_INTERFACES[i], { { "NULL", "NULL" },
+                                                     { "mac_addr", "00:00:00:00:00:00" } });
+                intf_table.set(PERF_INTERFACES[i] + ":" + getHostIp(i, 1) + "/16", { { "scope", "global" },
+                                                                                      { "family", "IPv4" } });
+                for (size_t host = 2; host < NEXTHOPS_PER_INTERFACE + 2; host++)
+                {
+                    neigh_table.set(PERF_INTERFACES[i] + ":" + getHostIp(i, host), { { "neigh", getMac(i, host) },
+                                                                                     { "family", "IPv4" } });
+                }
+            }
+            gIntfsOrch->addExistingData(&intf_table);
+            static_cast<Orch *>(gIntfsOrch)->doTask();
+
+            gNeighOrch->addExistingData(&neigh_table);
+            static_cast<Orch *>(gNeighOrch)->doTask();
+        }
+
+        Consumer *getConsumer(Orch *orch, const string &table)
+        {
+            return dynamic_cast<Consumer *>(orch->getExecutor(table));
+        }
+
+        /*
+         * Run doTask on the consumers until they are empty or no more entries
+         * can be processed. Returns the number of entries left unprocessed.
+         */
+        size_t drain(const vector<Consumer *> &consumers)
+        {
+            size_t pending = 0;
+            size_t last_pending;
+
+            do
+            {
+                last_pending = pending;
+                pending = 0;
+                for (auto consumer : consumers)
+                {
+                    consumer->drain();
+                    pending += consumer->m_toSync.size();
+                }
+            } while (pending != 0 && pending != last_pending);
+
+            return pending;
+        }
+
+        void accountBatch(PerfResult &result, size_t entries, chrono::steady_clock::time_point start)
+        {
+            double usec = static_cast<double>(chrono::duration_cast<chrono::nanoseconds>(
+                              chrono::steady_clock::now() - start).count()) / 1000;
+
+            result.entries += entries;
+            result.total_usec += usec;
+            result.latencies.insert(result.latencies.end(), entries, usec / static_cast<double>(entries));
+        }
+
+        /* Queue a port state change notification on the consumer, as received from syncd */
+        void queuePortStateChange(NotificationConsumer *consumer, sai_object_id_t port_id, sai_port_oper_status_t status)
+        {
+            sai_port_oper_status_notification_t port_oper_status;
+            port_oper_status.port_id = port_id;
+            port_oper_status.port_state = status;
+            string msg = JSon::buildJson({ { "port_state_change", sai_serialize_port_oper_status_ntf(1, &port_oper_status) } });
+
+            mockReply = (redisReply *)calloc(sizeof(redisReply), 1);
+            mockReply->type = REDIS_REPLY_ARRAY;
+            mockReply->elements = 3; // REDIS_PUBLISH_MESSAGE_ELEMNTS
+            mockReply->element = (redisReply **)calloc(sizeof(redisReply *), mockReply->elements);
+            mockReply->element[2] = (redisReply *)calloc(sizeof(redisReply), 1);
+            mockReply->element[2]->type = REDIS_REPLY_STRING;
+            mockReply->element[2]->str = (char *)calloc(1, msg.length() + 1);
+            memcpy(mockReply->element[2]->str, msg.c_str(), msg.length());
+
+            consumer->readData();
+            mockReply = nullptr;
+        }
+
+        PerfResult runWorkload(const string &name, Orch *orch, const string &table,
+                               const vector<KeyOpFieldsValuesTuple> &entries)
+        {
+            PerfResult result;
+            result.name = name;
+
+            Consumer *consumer = getConsumer(orch, table);
+            EXPECT_NE(consumer, nullptr);
+            if (consumer == nullptr)
+            {
+                return result;
+            }
+
+            for (size_t offset = 0; offset < entries.size(); offset += m_batchSize)
+            {
+                size_t count = min(m_batchSize, entries.size() - offset);
+                deque<KeyOpFieldsValuesTuple> batch(entries.begin() + offset, entries.begin() + offset + count);
+
+                auto start = chrono::steady_clock::now();
+                consumer->addToSync(batch);
+                result.pending = drain({ consumer });
+                accountBatch(result, count, start);
+            }
+
+            result.report();
+            return result;
+        }
+
+        /*
+         * Replay the records of a swss.rec file, in format of
+         * timestamp|TABLE:key|OP|field:value|..., through the consumers
+         * subscribing to the recorded tables.
+         */
+        PerfResult replayRecord(const string &path)
+        {
+            PerfResult result;
+            result.name = "record";
+
+            ifstream file(path);
+            EXPECT_TRUE(file.is_open()) << "Failed to open " << path;
+
+            string line;
+            size_t count = 0;
+            vector<Consumer *> consumers;
+            auto start = chrono::steady_clock::now();
+
+            while (getline(file, line))
+            {
+                auto tokens = tokenize(line, '|', 3);
+                if (tokens.size() < 3)
+                {
+                    continue;
+                }
+
+                auto v_key = tokenize(tokens[1], ':', 1);
+                if (v_key.size() < 2)
+                {
+                    continue;
+                }
+
+                Consumer *consumer = nullptr;
+                for (auto orch : ut_orch_list)
+                {
+                    if (*orch != nullptr && (consumer = getConsumer(*orch, v_key[0])) != nullptr)
+                    {
+                        break;
+                    }
+                }
+
+                if (consumer == nullptr)
+                {
+                    continue;
+                }
+
+                vector<FieldValueTuple> fvs;
+                if (tokens.size() > 3)
+                {
+                    for (const auto &tuple : tokenize(tokens[3], '|'))
+                    {
+                        auto v_tuple = tokenize(tuple, ':', 1);
+                        fvs.emplace_back(v_tuple[0], v_tuple.size() == 1 ? "" : v_tuple[1]);
+                    }
+                }
+
+                if (count == 0)
+                {
+                    start = chrono::steady_clock::now();
+                }
+
+                consumer->addToSync(KeyOpFieldsValuesTuple(v_key[1], tokens[2], fvs));
+                if (find(consumers.begin(), consumers.end(), consumer) == consumers.end())
+                {
+                    consumers.push_back(consumer);
+                }
+
+                if (++count >= m_batchSize)
+                {
+                    result.pending = drain(consumers);
+                    accountBatch(result, count, start);
+                    count = 0;
+                }
+            }
+
+            if (count > 0)
+            {
+                result.pending = drain(consumers);
+                accountBatch(result, count, start);
+            }
+
+            result.report();
+            return result;
+        }
+
+        vector<KeyOpFieldsValuesTuple> generateNeighbors(size_t count)
+        {
+            vector<KeyOpFieldsValuesTuple> entries;
+            entries.reserve(count);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                size_t intf_index = i % PERF_INTERFACES.size();
+                size_t host = NEXTHOPS_PER_INTERFACE + 2 + i / PERF_INTERFACES.size();
+                entries.emplace_back(PERF_INTERFACES[intf_index] + ":" + getHostIp(intf_index, host), SET_COMMAND,
+                                     vector<FieldValueTuple>{ { "neigh", getMac(intf_index, host) },
+                                                              { "family", "IPv4" } });
+            }
+
+            return entries;
+        }
+
+        /*
+         * Routes with a single next hop and ECMP routes alternate. The ECMP
+         * routes of a round use next hop sets rotated by the round number, so
+         * that every round moves the routes to different next hop groups.
+         */
+        vector<KeyOpFieldsValuesTuple> generateRoutes(size_t count, size_t width, size_t round)
+        {
+            vector<KeyOpFieldsValuesTuple> entries;
+            entries.reserve(count);
+
+            size_t nexthops = PERF_INTERFACES.size() * NEXTHOPS_PER_INTERFACE;
+            width = max<size_t>(min(width, nexthops), 1);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                size_t members = i % 2 == 0 ? 1 : width;
+                string nexthop_str, ifname_str;
+
+                for (size_t m = 0; m < members; m++)
+                {
+                    size_t nh = (i / 2 + m + round) % nexthops;
+                    size_t intf_index = nh % PERF_INTERFACES.size();
+                    size_t host = 2 + nh / PERF_INTERFACES.size();
+
+                    nexthop_str += (m ? "," : "") + getHostIp(intf_index, host);
+                    ifname_str += (m ? "," : "") + PERF_INTERFACES[intf_index];
+                }
+
+                entries.emplace_back(getRoutePrefix(i), SET_COMMAND,
+                                     vector<FieldValueTuple>{ { "nexthop", nexthop_str },
+                                                              { "ifname", ifname_str } });
+            }
+
+            return entries;
+        }
+
+        vector<KeyOpFieldsValuesTuple> generateAclRules(size_t count)
+        {
+            vector<KeyOpFieldsValuesTuple> entries;
+            entries.reserve(count);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                string src_ip = to_string(30 + (i >> 24)) + "." + to_string((i >> 16) & 0xff) + "." +
+                                to_string((i >> 8) & 0xff) + "." + to_string(i & 0xff) + "/32";
+                entries.emplace_back(PERF_ACL_TABLE + "|RULE_" + to_string(i), SET_COMMAND,
+                                     vector<FieldValueTuple>{ { RULE_PRIORITY, to_string(10 + i % 9000) },
+                                                              { ACTION_PACKET_ACTION, PACKET_ACTION_DROP },
+                                                              { MATCH_SRC_IP, src_ip } });
+            }
+
+            return entries;
+        }
+
+        vector<KeyOpFieldsValuesTuple> generateDeletes(const vector<KeyOpFieldsValuesTuple> &entries)
+        {
+            vector<KeyOpFieldsValuesTuple> deletes;
+            deletes.reserve(entries.size());
+
+            for (const auto &entry : entries)
+            {
+                deletes.emplace_back(kfvKey(entry), DEL_COMMAND, vector<FieldValueTuple>{});
+            }
+
+            return deletes;
+        }
+    };
+
+    TEST_F(OrchagentPerfTest, Neighbors)
+    {
+        size_t count = getScale("ORCHAGENT_PERF_NEIGHBORS", 500);
+        size_t initial = gNeighOrch->m_syncdNeighbors.size();
+        auto entries = generateNeighbors(count);
+
+        auto result = runWorkload("neigh_add", gNeighOrch, APP_NEIGH_TABLE_NAME, entries);
+        ASSERT_EQ(result.pending, 0);
+        ASSERT_EQ(gNeighOrch->m_syncdNeighbors.size(), initial + count);
+
+        result = runWorkload("neigh_del", gNeighOrch, APP_NEIGH_TABLE_NAME, generateDeletes(entries));
+        ASSERT_EQ(result.pending, 0);
+        ASSERT_EQ(gNeighOrch->m_syncdNeighbors.size(), initial);
+    }
+
+    TEST_F(OrchagentPerfTest, RoutesAndEcmpChurn)
+    {
+        size_t count = getScale("ORCHAGENT_PERF_ROUTES", 1000);
+        size_t width = getScale("ORCHAGENT_PERF_ECMP_WIDTH", 4);
+        size_t rounds = getScale("ORCHAGENT_PERF_ECMP_ROUNDS", 5);
+        size_t initial = gRouteOrch->getSyncdRoutes().at(gVirtualRouterId).size();
+        auto entries = generateRoutes(count, width, 0);
+
+        auto result = runWorkload("route_add", gRouteOrch, APP_ROUTE_TABLE_NAME, entries);
+        ASSERT_EQ(result.pending, 0);
+        ASSERT_EQ(gRouteOrch->getSyncdRoutes().at(gVirtualRouterId).size(), initial + count);
+
+        size_t routes = initial + count;
+        cout << "[ PERF     ] route table " << gRouteOrch->getSyncdRoutesMemoryUsage() / routes
+             << " bytes per route" << endl;
+
+        for (size_t round = 1; round <= rounds; round++)
+        {
+            result = runWorkload("ecmp_churn", gRouteOrch, APP_ROUTE_TABLE_NAME, generateRoutes(count, width, round));
+            ASSERT_EQ(result.pending, 0);
+        }
+
+        result = runWorkload("route_del", gRouteOrch, APP_ROUTE_TABLE_NAME, generateDeletes(entries));
+        ASSERT_EQ(result.pending, 0);
+        ASSERT_EQ(gRouteOrch->getSyncdRoutes().at(gVirtualRouterId).size(), initial);
+        ASSERT_EQ(gRouteOrch->getNhgCount(), 0);
+    }
+
+    /*
+     * Route churn with next hop observers attached to addresses covered by
+     * the routes, as done by the mirror sessions and the tunnel endpoints.
+     */
+    TEST_F(OrchagentPerfTest, RouteObservers)
+    {
+        size_t count = getScale("ORCHAGENT_PERF_ROUTES", 1000);
+        size_t width = getScale("ORCHAGENT_PERF_ECMP_WIDTH", 4);
+        size_t observer_count = min(getScale("ORCHAGENT_PERF_OBSERVERS", 200), count);
+        auto entries = generateRoutes(count, width, 0);
+
+        vector<PerfNextHopObserver> observers(observer_count);
+        vector<IpAddress> addresses;
+        for (size_t i = 0; i < observer_count; i++)
+        {
+            addresses.push_back(IpPrefix(getRoutePrefix(i * count / observer_count)).getIp());
+        }
+
+        PerfResult attach;
+        attach.name = "observe";
+        for (size_t i = 0; i < observer_count; i++)
+        {
+            auto start = chrono::steady_clock::now();
+            gRouteOrch->attach(&observers[i], addresses[i]);
+            accountBatch(attach, 1, start);
+            ASSERT_EQ(observers[i].prefix, IpPrefix("0.0.0.0/0"));
+        }
+        attach.report();
+
+        auto result = runWorkload("route_add", gRouteOrch, APP_ROUTE_TABLE_NAME, entries);
+        ASSERT_EQ(result.pending, 0);
+        for (size_t i = 0; i < observer_count; i++)
+        {
+            ASSERT_EQ(observers[i].prefix, IpPrefix(addresses[i].getIp(), 24));
+        }
+
+        result = runWorkload("route_del", gRouteOrch, APP_ROUTE_TABLE_NAME, generateDeletes(entries));
+        ASSERT_EQ(result.pending, 0);
+        for (size_t i = 0; i < observer_count; i++)
+        {
+            ASSERT_EQ(observers[i].prefix, IpPrefix("0.0.0.0/0"));
+            gRouteOrch->detach(&observers[i], addresses[i]);
+        }
+    }
+
+    /*
+     * Oper status flap storm of all the ports, e.g. on a line card reboot. The
+     * notifications are processed one at a time, then all at once as they
+     * pile up while orchagent is busy.
+     */
+    TEST_F(OrchagentPerfTest, PortFlapStorm)
+    {
+        size_t flaps = getScale("ORCHAGENT_PERF_PORT_FLAPS", 10);
+        auto consumer = static_cast<Notifier *>(gPortsOrch->getExecutor("PORT_STATUS_NOTIFICATIONS"))->getNotificationConsumer();
+
+        vector<Port> ports;
+        for (const auto &it : gPortsOrch->getAllPorts())
+        {
+            if (it.second.m_type == Port::PHY)
+            {
+                ports.push_back(it.second);
+            }
+        }
+
+        for (auto storm : { false, true })
+        {
+            PerfResult result;
+            result.name = storm ? "flap_storm" : "flap_single";
+
+            auto start = chrono::steady_clock::now();
+            for (size_t flap = 0; flap < 2 * flaps; flap++)
+            {
+                auto status = flap % 2 == 0 ? SAI_PORT_OPER_STATUS_UP : SAI_PORT_OPER_STATUS_DOWN;
+                for (const auto &port : ports)
+                {
+                    if (!storm)
+                    {
+                        start = chrono::steady_clock::now();
+                    }
+                    queuePortStateChange(consumer, port.m_port_id, status);
+                    if (!storm)
+                    {
+                        gPortsOrch->doTask(*consumer);
+                        accountBatch(result, 1, start);
+                    }
+                }
+            }
+
+            if (storm)
+            {
+                gPortsOrch->doTask(*consumer);
+                accountBatch(result, 2 * flaps * ports.size(), start);
+            }
+            result.report();
+
+            // Every port ends down with all its transitions counted
+            for (const auto &port : ports)
+            {
+                Port p;
+                ASSERT_TRUE(gPortsOrch->getPort(port.m_alias, p));
+                ASSERT_EQ(p.m_oper_status, SAI_PORT_OPER_STATUS_DOWN);
+                ASSERT_EQ(p.m_flap_count, port.m_flap_count + (storm ? 4 : 2) * flaps);
+            }
+        }
+    }
+
+    /*
+     * VNET tunnel routes monitored by BFD. Each route uses an ECMP group of
+     * consecutive endpoints, so that an endpoint is shared by several groups
+     * and a group by several routes.
+     */
+    class OrchagentVnetPerfTest : public OrchagentPerfTest
+    {
+    protected:
+        VNetOrch *m_vnetOrch;
+        VNetRouteOrch *m_vnetRouteOrch;
+
+        void PostSetUp() override
+        {
+            TableConnector stateDbBfdSessionTable(m_state_db.get(), STATE_BFD_SESSION_TABLE_NAME);
+            gBfdOrch = new BfdOrch(m_app_db.get(), APP_BFD_SESSION_TABLE_NAME, stateDbBfdSessionTable);
+            gDirectory.set(gBfdOrch);
+            ut_orch_list.push_back((Orch **)&gBfdOrch);
+
+            m_vnetOrch = new VNetOrch(m_app_db.get(), APP_VNET_TABLE_NAME);
+            gDirectory.set(m_vnetOrch);
+            ut_orch_list.push_back((Orch **)&m_vnetOrch);
+
+            vector<string> vnet_tables = {
+                APP_VNET_RT_TABLE_NAME,
+                APP_VNET_RT_TUNNEL_TABLE_NAME
+            };
+            m_vnetRouteOrch = new VNetRouteOrch(m_app_db.get(), vnet_tables, m_vnetOrch);
+            gDirectory.set(m_vnetRouteOrch);
+            ut_orch_list.push_back((Orch **)&m_vnetRouteOrch);
+        }
+    };
+
+    /*
+     * All the BFD sessions of the endpoints going up, then down, e.g. on a
+     * link failure. The state changes are delivered one session at a time,
+     * then all the sessions in a single batch.
+     */
+    TEST_F(OrchagentVnetPerfTest, BfdConvergence)
+    {
+        const size_t width = 4;
+        size_t endpoints = max<size_t>(getScale("ORCHAGENT_PERF_VNET_ENDPOINTS", 64), width);
+        size_t routes = max<size_t>(getScale("ORCHAGENT_PERF_VNET_ROUTES", 256), 1);
+
+        auto result = runWorkload("vxlan_tunnel", m_VxlanTunnelOrch, APP_VXLAN_TUNNEL_TABLE_NAME,
+                                  { { "tunnel_v4", SET_COMMAND, { { "src_ip", "10.10.10.10" } } } });
+        ASSERT_EQ(result.pending, 0);
+
+        result = runWorkload("vnet", m_vnetOrch, APP_VNET_TABLE_NAME,
+                             { { "Vnet1", SET_COMMAND, { { "vxlan_tunnel", "tunnel_v4" },
+                                                         { "vni", "10000" } } } });
+        ASSERT_EQ(result.pending, 0);
+        ASSERT_TRUE(m_vnetOrch->isVnetExists("Vnet1"));
+
+        vector<KeyOpFieldsValuesTuple> entries;
+        for (size_t i = 0; i < routes; i++)
+        {
+            string endpoint_list;
+            string monitor_list;
+            for (size_t j = 0; j < width; j++)
+            {
+                size_t endpoint = (i + j) % endpoints;
+                endpoint_list += (j == 0 ? "" : ",") + getVnetEndpoint(endpoint, false);
+                monitor_list += (j == 0 ? "" : ",") + getVnetEndpoint(endpoint, true);
+            }
+            entries.emplace_back("Vnet1:" + getRoutePrefix(i), SET_COMMAND,
+                                 vector<FieldValueTuple>{ { "endpoint", endpoint_list },
+                                                          { "endpoint_monitor", monitor_list } });
+        }
+
+        result = runWorkload("vnet_route", m_vnetRouteOrch, APP_VNET_RT_TUNNEL_TABLE_NAME, entries);
+        ASSERT_EQ(result.pending, 0);
+
+        Table stateRouteTable(m_state_db.get(), STATE_VNET_RT_TUNNEL_TABLE_NAME);
+
+        for (auto batched : { false, true })
+        {
+            for (auto state : { SAI_BFD_SESSION_STATE_UP, SAI_BFD_SESSION_STATE_DOWN })
+            {
+                PerfResult bfd_result;
+                bfd_result.name = string(batched ? "bfd_batch_" : "bfd_single_") +
+                              (state == SAI_BFD_SESSION_STATE_UP ? "up" : "down");
+
+                BfdUpdateBatch batch;
+                for (size_t i = 0; i < endpoints; i++)
+                {
+                    BfdUpdate update;
+                    update.peer = "default|default|" + getVnetEndpoint(i, true);
+                    update.state = state;
+                    batch.updates.push_back(update);
+                }
+
+                if (batched)
+                {
+                    auto start = chrono::steady_clock::now();
+                    m_vnetRouteOrch->update(SUBJECT_TYPE_BFD_SESSION_STATE_BATCH_CHANGE, &batch);
+                    accountBatch(bfd_result, endpoints, start);
+                }
+                else
+                {
+                    for (const auto &update : batch.updates)
+                    {
+                        BfdUpdateBatch single;
+                        single.updates.push_back(update);
+
+                        auto start = chrono::steady_clock::now();
+                        m_vnetRouteOrch->update(SUBJECT_TYPE_BFD_SESSION_STATE_BATCH_CHANGE, &single);
+                        accountBatch(bfd_result, 1, start);
+                    }
+                }
+                bfd_result.report();
+
+                // The route states are written at the end of the loop iteration
+                m_vnetRouteOrch->flushStateWrites();
+
+                // Every route follows the state of its endpoints
+                for (size_t i = 0; i < routes; i++)
+                {
+                    string route_state;
+                    ASSERT_TRUE(stateRouteTable.hget("Vnet1|" + getRoutePrefix(i), "state", route_state));
+                    ASSERT_EQ(route_state, state == SAI_BFD_SESSION_STATE_UP ? "active" : "inactive");
+                }
+            }
+        }
+    }
+
+    TEST_F(OrchagentPerfTest, AclRules)
+    {
+        size_t count = max<size_t>(getScale("ORCHAGENT_PERF_ACL_RULES", 200), 1);
+
+        auto result = runWorkload("acl_table", gAclOrch, CFG_ACL_TABLE_TABLE_NAME,
+                                  { { PERF_ACL_TABLE, SET_COMMAND, { { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                                                                     { ACL_TABLE_STAGE, STAGE_INGRESS },
+                                                                     { ACL_TABLE_PORTS, ETHERNET0 } } } });
+        ASSERT_EQ(result.pending, 0);
+        ASSERT_NE(gAclOrch->getTableById(PERF_ACL_TABLE), SAI_NULL_OBJECT_ID);
+
+        auto entries = generateAclRules(count);
+        result = runWorkload("acl_rule_add", gAclOrch, CFG_ACL_RULE_TABLE_NAME, entries);
+        ASSERT_EQ(result.pending, 0);
+        ASSERT_NE(gAclOrch->getAclRule(PERF_ACL_TABLE, "RULE_" + to_string(count - 1)), nullptr);
+
+        result = runWorkload("acl_rule_del", gAclOrch, CFG_ACL_RULE_TABLE_NAME, generateDeletes(entries));
+        ASSERT_EQ(result.pending, 0);
+        ASSERT_EQ(gAclOrch->getAclRule(PERF_ACL_TABLE, "RULE_0"), nullptr);
+    }
+
+    TEST_F(OrchagentPerfTest, Record)
+    {
+        const char *path = getenv("ORCHAGENT_PERF_RECORD");
+        if (path == nullptr || *path == '\0')
+        {
+            GTEST_SKIP() << "ORCHAGENT_PERF_RECORD is not set";
+        }
+
+        replayRecord(path);
+    }
+}
@@ -19,6 +19,49 @@ namespace orchdaemon_test
     DBConnector config_db("CONFIG_DB", 0);
     DBConnector counters_db("COUNTERS_DB", 0);
 
+    /*
+     * Orch with a single table. Tasks wait for the dependency to have been run
+     * once, and "stuck" tasks are never processed.
+     */
+    class WarmRestoreTestOrch : public Orch
+    {
+        public:
+            WarmRestoreTestOrch(DBConnector *db, const string &tableName, WarmRestoreTestOrch *dependency = nullptr) :
+                Orch(db, tableName),
+                m_tableName(tableName),
+                m_dependency(dependency)
+            {
+            }
+
+            void addTask(const string &key)
+            {
+                auto consumer = dynamic_cast<Consumer *>(getExecutor(m_tableName));
+                consumer->addToSync(KeyOpFieldsValuesTuple(key, SET_COMMAND, vector<FieldValueTuple>()));
+            }
+
+            void doTask(Consumer &consumer) override
+            {
+                m_runs++;
+
+                auto it = consumer.m_toSync.begin();
+                while (it != consumer.m_toSync.end())
+                {
+                    if (kfvKey(it->second) == "stuck" || (m_dependency && m_dependency->m_runs == 0))
+                    {
+                        it++;
+                        continue;
+                    }
+                    it = consumer.m_toSync.erase(it);
+                }
+            }
+
+            int m_runs = 0;
+
+        private:
+            string m_tableName;
+            WarmRestoreTestOrch *m_dependency;
+    };
+
     class OrchDaemonTest : public ::testing::Test
     {
         public:
@@ -49,4 +92,27 @@ namespace orchdaemon_test
 
         orchd->logRotate();
     }
+
+    TEST_F(OrchDaemonTest, processWarmRestoreTasks)
+    {
+        auto ports = new WarmRestoreTestOrch(&appl_db, "WARM_RESTORE_PORT_TABLE");
+        auto routes = new WarmRestoreTestOrch(&appl_db, "WARM_RESTORE_ROUTE_TABLE", ports);
+
+        // Routes are listed first but depend on ports
+        orchd->addOrchList(routes);
+        orchd->addOrchList(ports);
+        orchd->addOrchDependency(routes, ports);
+
+        ports->addTask("Ethernet0");
+        ports->addTask("stuck");
+        routes->addTask("10.0.0.0/24");
+        routes->addTask("10.0.1.0/24");
+
+        ASSERT_EQ(orchd->processWarmRestoreTasks(), 1);
+
+        // Routes are processed once, after ports have settled
+        ASSERT_EQ(routes->m_runs, 1);
+        ASSERT_EQ(routes->getPendingTaskCount(), 0);
+        ASSERT_EQ(ports->getPendingTaskCount(), 1);
+    }
 }
@@ -62,6 +62,11 @@ struct Portal
         {
             crmOrch->getResAvailableCounters();
         }
+
+        static void updateCrmCountersTable(CrmOrch *crmOrch)
+        {
+            crmOrch->updateCrmCountersTable();
+        }
     };
 
     struct CoppOrchInternal
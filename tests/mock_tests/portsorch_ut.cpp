@@ -679,6 +679,102 @@ namespace portsorch_test
         cleanupPorts(gPortsOrch);
     }
 
+    /*
+    * Test that the state changes of a port pending in the same batch are coalesced
+    */
+    TEST_F(PortsOrchTest, PortOperStatusCoalescing)
+    {
+        struct OperStateObserver : public Observer
+        {
+            vector<sai_port_oper_status_t> updates;
+
+            void update(SubjectType type, void *cntx) override
+            {
+                if (type == SUBJECT_TYPE_PORT_OPER_STATE_CHANGE)
+                {
+                    updates.push_back(static_cast<PortOperStateUpdate *>(cntx)->operStatus);
+                }
+            }
+        };
+
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+        auto ports = ut_helper::getInitialSaiPorts();
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        portTable.set("PortInitDone", { { "lanes", "0" } });
+        gPortsOrch->addExistingData(&portTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        Port port0, port4;
+        gPortsOrch->getPort("Ethernet0", port0);
+        gPortsOrch->getPort("Ethernet4", port4);
+        ASSERT_TRUE(port0.m_oper_status != SAI_PORT_OPER_STATUS_UP);
+
+        OperStateObserver observer;
+        gPortsOrch->attach(&observer);
+
+        auto exec = static_cast<Notifier *>(gPortsOrch->getExecutor("PORT_STATUS_NOTIFICATIONS"));
+        auto consumer = exec->getNotificationConsumer();
+
+        // Ethernet0 flaps up, down and up, Ethernet4 goes up and back down
+        vector<pair<sai_object_id_t, sai_port_oper_status_t>> events = {
+            { port0.m_port_id, SAI_PORT_OPER_STATUS_UP },
+            { port4.m_port_id, SAI_PORT_OPER_STATUS_UP },
+            { port0.m_port_id, SAI_PORT_OPER_STATUS_DOWN },
+            { port4.m_port_id, SAI_PORT_OPER_STATUS_DOWN },
+            { port0.m_port_id, SAI_PORT_OPER_STATUS_UP },
+        };
+        for (const auto &event : events)
+        {
+            mockReply = (redisReply *)calloc(sizeof(redisReply), 1);
+            mockReply->type = REDIS_REPLY_ARRAY;
+            mockReply->elements = 3; // REDIS_PUBLISH_MESSAGE_ELEMNTS
+            mockReply->element = (redisReply **)calloc(sizeof(redisReply *), mockReply->elements);
+            mockReply->element[2] = (redisReply *)calloc(sizeof(redisReply), 1);
+            mockReply->element[2]->type = REDIS_REPLY_STRING;
+            sai_port_oper_status_notification_t port_oper_status;
+            port_oper_status.port_id = event.first;
+            port_oper_status.port_state = event.second;
+            std::string data = sai_serialize_port_oper_status_ntf(1, &port_oper_status);
+            std::vector<FieldValueTuple> notifyValues;
+            FieldValueTuple opdata("port_state_change", data);
+            notifyValues.push_back(opdata);
+            std::string msg = swss::JSon::buildJson(notifyValues);
+            mockReply->element[2]->str = (char*)calloc(1, msg.length() + 1);
+            memcpy(mockReply->element[2]->str, msg.c_str(), msg.length());
+
+            consumer->readData();
+            mockReply = nullptr;
+        }
+
+        // All the pending notifications are processed at once
+        gPortsOrch->doTask(*consumer);
+
+        // Only the final state is reported, the flap count accounts for every transition
+        gPortsOrch->getPort("Ethernet0", port0);
+        ASSERT_EQ(port0.m_oper_status, SAI_PORT_OPER_STATUS_UP);
+        ASSERT_EQ(port0.m_flap_count, 3);
+        gPortsOrch->getPort("Ethernet4", port4);
+        ASSERT_EQ(port4.m_oper_status, SAI_PORT_OPER_STATUS_DOWN);
+        ASSERT_EQ(port4.m_flap_count, 2);
+        ASSERT_EQ(observer.updates, vector<sai_port_oper_status_t>({ SAI_PORT_OPER_STATUS_UP }));
+
+        // The oper status and the flap count are written once the batch is flushed
+        string value;
+        ASSERT_TRUE(portTable.hget("Ethernet0", "oper_status", value));
+        ASSERT_EQ(value, "up");
+        ASSERT_TRUE(portTable.hget("Ethernet4", "flap_count", value));
+        ASSERT_EQ(value, "2");
+        Table statePortTable = Table(m_state_db.get(), STATE_PORT_TABLE_NAME);
+        ASSERT_TRUE(statePortTable.hget("Ethernet0", "speed", value));
+
+        gPortsOrch->detach(&observer);
+        cleanupPorts(gPortsOrch);
+    }
+
     TEST_F(PortsOrchTest, PortBulkCreateRemove)
     {
         auto portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
@@ -1,6 +1,10 @@
 #include "gtest/gtest.h"
 #include <net/if.h>
+#include <linux/rtnetlink.h>
 #include <netlink/route/link.h>
+#include <chrono>
+#include <deque>
+#include <iostream>
 #include "mock_table.h"
 #define private public 
 #include "linksync.h"
@@ -24,6 +28,53 @@ extern "C" {
     }
 }
 
+/* Interfaces brought down by RTM_SETLINK requests */
+std::vector<int> g_setLinkDownIfindexes;
+std::vector<uint8_t> g_nlAcks;
+
+/* Mock the netlink socket used to bring down the old interfaces */
+extern "C" {
+    int nl_send_auto(struct nl_sock *sk, struct nl_msg *msg)
+    {
+        nl_complete_msg(sk, msg);
+        struct nlmsghdr *hdr = nlmsg_hdr(msg);
+
+        if (hdr->nlmsg_type == RTM_SETLINK)
+        {
+            struct ifinfomsg *ifi = static_cast<struct ifinfomsg *>(nlmsg_data(hdr));
+            if ((ifi->ifi_change & IFF_UP) && !(ifi->ifi_flags & IFF_UP))
+            {
+                g_setLinkDownIfindexes.push_back(ifi->ifi_index);
+            }
+        }
+
+        struct nlmsghdr ack_hdr;
+        struct nlmsgerr err;
+        memset(&ack_hdr, 0, sizeof(ack_hdr));
+        ack_hdr.nlmsg_len = static_cast<uint32_t>(NLMSG_LENGTH(sizeof(err)));
+        ack_hdr.nlmsg_type = NLMSG_ERROR;
+        ack_hdr.nlmsg_seq = hdr->nlmsg_seq;
+        err.error = 0;
+        err.msg = *hdr;
+
+        auto ack_hdr_bytes = reinterpret_cast<uint8_t *>(&ack_hdr);
+        auto err_bytes = reinterpret_cast<uint8_t *>(&err);
+        g_nlAcks.insert(g_nlAcks.end(), ack_hdr_bytes, ack_hdr_bytes + NLMSG_HDRLEN);
+        g_nlAcks.insert(g_nlAcks.end(), err_bytes, err_bytes + NLMSG_ALIGN(sizeof(err)));
+
+        return static_cast<int>(hdr->nlmsg_len);
+    }
+
+    int nl_recv(struct nl_sock *sk, struct sockaddr_nl *nla, unsigned char **buf, struct ucred **creds)
+    {
+        int len = static_cast<int>(g_nlAcks.size());
+        *buf = static_cast<unsigned char *>(malloc(g_nlAcks.size()));
+        memcpy(*buf, g_nlAcks.data(), g_nlAcks.size());
+        g_nlAcks.clear();
+        return len;
+    }
+}
+
 extern std::string mockCmdStdcout;
 extern std::vector<std::string> mockCallArgs;
 std::set<std::string> g_portSet;
@@ -72,6 +123,8 @@ namespace portsyncd_ut
             m_state_db = std::make_shared<swss::DBConnector>("STATE_DB", 0);
             m_portCfgTable = std::make_shared<swss::Table>(m_config_db.get(), CFG_PORT_TABLE_NAME);
             m_portAppTable = std::make_shared<swss::Table>(m_app_db.get(), APP_PORT_TABLE_NAME);
+            g_setLinkDownIfindexes.clear();
+            g_nlAcks.clear();
         }
 
         virtual void TearDown() override {
@@ -203,7 +256,7 @@ namespace portsyncd_ut
     {  
         if_ni_mock = populateNetDevAdvanced();
         swss::LinkSync sync(m_app_db.get(), m_state_db.get());
-        ASSERT_EQ(mockCallArgs.back(), "ip link set \"Ethernet0\" down");
+        ASSERT_EQ(g_setLinkDownIfindexes, std::vector<int>({ 142 }));
         ASSERT_NE(sync.m_ifindexOldNameMap.find(142), sync.m_ifindexOldNameMap.end());
         ASSERT_EQ(sync.m_ifindexOldNameMap[142], "Ethernet0");
     }
@@ -321,7 +374,7 @@ namespace portsyncd_ut
     TEST_F(PortSyncdTest, test_onMsgIgnoreOldNetDev){
         if_ni_mock = populateNetDevAdvanced();
         swss::LinkSync sync(m_app_db.get(), m_state_db.get());
-        ASSERT_EQ(mockCallArgs.back(), "ip link set \"Ethernet0\" down");
+        ASSERT_EQ(g_setLinkDownIfindexes, std::vector<int>({ 142 }));
         ASSERT_NE(sync.m_ifindexOldNameMap.find(142), sync.m_ifindexOldNameMap.end());
         ASSERT_EQ(sync.m_ifindexOldNameMap[142], "Ethernet0");
 
@@ -340,4 +393,69 @@ namespace portsyncd_ut
         std::vector<swss::FieldValueTuple> ovalues;
         ASSERT_EQ(sync.m_statePortTable.get("Ethernet0", ovalues), false);
     }
+
+    /*
+     * Boot of a 512 ports breakout configuration: the old kernel interfaces
+     * are brought down and a RTM_NEWLINK of each port is written to STATE_DB.
+     */
+    TEST_F(PortSyncdTest, test_bootPerf)
+    {
+        const size_t ports = 512;
+
+        if_ni_mock = (struct if_nameindex*) calloc(ports + 1, sizeof(struct if_nameindex));
+        std::vector<std::string> names;
+        for (size_t i = 0; i < ports; i++)
+        {
+            names.push_back("Ethernet" + std::to_string(i * 2));
+        }
+        for (size_t i = 0; i < ports; i++)
+        {
+            if_ni_mock[i].if_index = static_cast<unsigned int>(1000 + i);
+            if_ni_mock[i].if_name = const_cast<char *>(names[i].c_str());
+        }
+
+        for (const auto &name : names)
+        {
+            m_portAppTable->set(name, { { "mtu", "9100" } });
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        swss::LinkSync sync(m_app_db.get(), m_state_db.get());
+        auto sweep_usec = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        ASSERT_EQ(g_setLinkDownIfindexes.size(), ports);
+        for (const auto &cmd : mockCallArgs)
+        {
+            ASSERT_EQ(cmd.find("ip link set"), std::string::npos);
+        }
+
+        /* The new interfaces of the ports are not the old ones */
+        std::vector<unsigned int> flags = {IFF_UP, IFF_RUNNING};
+        std::vector<struct nl_object*> msgs;
+        for (size_t i = 0; i < ports; i++)
+        {
+            msgs.push_back(draft_nlmsg(names[i], flags, "sx_netdev", "1c:34:da:1c:9f:00",
+                                       static_cast<int>(2000 + i), 9100, 0));
+        }
+
+        start = std::chrono::steady_clock::now();
+        for (auto msg : msgs)
+        {
+            sync.onMsg(RTM_NEWLINK, msg);
+        }
+        sync.flush();
+        auto newlink_usec = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "Boot of " << ports << " ports: old interfaces brought down in " << sweep_usec
+                  << " us, state of the new interfaces published in " << newlink_usec << " us" << std::endl;
+
+        std::vector<std::string> keys;
+        sync.m_statePortTable.getKeys(keys);
+        ASSERT_EQ(keys.size(), ports);
+
+        for (auto msg : msgs)
+        {
+            free_nlobj(msg);
+        }
+    }
 }
@@ -0,0 +1,191 @@
+#include "response_publisher.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+
+#include "zmqserver.h"
+
+/*
+ * Loopback benchmark of the ZMQ response channel.
+ *
+ * The responses of DASH and P4RT like workloads are published to a ZMQ
+ * server in the same process, standing for the controller, and the latency
+ * is measured from the publish() call to the reception of the response. The
+ * scale can be changed with the following environment variables:
+ *
+ *   RESPONSE_PUBLISHER_PERF_ENTRIES  number of responses (default 10000)
+ *   RESPONSE_PUBLISHER_PERF_BATCH    responses published between flushes (default 128)
+ *
+ * e.g. RESPONSE_PUBLISHER_PERF_ENTRIES=100000 ./tests_response_publisher --gtest_filter=ResponsePublisherPerf.*
+ */
+
+using namespace swss;
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+size_t getScale(const char *name, size_t default_value)
+{
+    const char *value = getenv(name);
+    if (value == nullptr || *value == '\0')
+    {
+        return default_value;
+    }
+
+    return static_cast<size_t>(strtoul(value, nullptr, 10));
+}
+
+// Records the reception time of the responses, in the order they are sent.
+class TimedReceiver : public ZmqMessageHandler
+{
+  public:
+    explicit TimedReceiver(size_t count)
+    {
+        m_times.reserve(count);
+    }
+
+    void handleReceivedData(const std::vector<std::shared_ptr<KeyOpFieldsValuesTuple>> &kcos) override
+    {
+        auto now = Clock::now();
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_times.insert(m_times.end(), kcos.size(), now);
+            m_messages++;
+        }
+        m_signal.notify_all();
+    }
+
+    bool wait(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        return m_signal.wait_for(lock, std::chrono::seconds(60), [&]() { return m_times.size() >= count; });
+    }
+
+    std::vector<Clock::time_point> m_times;
+    size_t m_messages = 0;
+
+  private:
+    std::mutex m_lock;
+    std::condition_variable m_signal;
+};
+
+struct Workload
+{
+    std::string name;
+    std::string db;
+    std::string table;
+    std::vector<KeyOpFieldsValuesTuple> entries;
+};
+
+// DASH routes, published by the DASH orchs in APPL_STATE_DB.
+Workload getDashWorkload(size_t count)
+{
+    Workload workload{"dash_route", "APPL_STATE_DB", "DASH_ROUTE_TABLE", {}};
+    for (size_t i = 0; i < count; i++)
+    {
+        std::string prefix = "10." + std::to_string((i >> 16) & 0xff) + "." + std::to_string((i >> 8) & 0xff) + "." +
+                             std::to_string(i & 0xff) + "/32";
+        workload.entries.emplace_back("F4939FEFC47E:" + prefix, SET_COMMAND,
+                                      std::vector<FieldValueTuple>{{"pb", std::string(48, 'r')}});
+    }
+
+    return workload;
+}
+
+// P4RT routes, published by P4Orch in APPL_DB.
+Workload getP4rtWorkload(size_t count)
+{
+    Workload workload{"p4rt_route", "APPL_DB", "P4RT_TABLE", {}};
+    for (size_t i = 0; i < count; i++)
+    {
+        std::string prefix = "10." + std::to_string((i >> 16) & 0xff) + "." + std::to_string((i >> 8) & 0xff) + "." +
+                             std::to_string(i & 0xff) + "/32";
+        workload.entries.emplace_back(
+            "FIXED_IPV4_TABLE:{\"match/ipv4_dst\":\"" + prefix + "\",\"match/vrf_id\":\"b4-traffic\"}", SET_COMMAND,
+            std::vector<FieldValueTuple>{{"action", "set_nexthop_id"}, {"param/nexthop_id", "nh-" + std::to_string(i % 64)}});
+    }
+
+    return workload;
+}
+
+void runWorkload(const Workload &workload, const std::string &endpoint, bool buffered, bool dbPersistence)
+{
+    size_t count = workload.entries.size();
+    size_t batch = std::max<size_t>(getScale("RESPONSE_PUBLISHER_PERF_BATCH", 128), 1);
+
+    TimedReceiver receiver(count);
+    ZmqServer server{endpoint};
+    server.registerMessageHandler(workload.db, "APPL_DB_" + workload.table + "_RESPONSE_CHANNEL", &receiver);
+    ZmqClient client{endpoint};
+
+    std::vector<Clock::time_point> published;
+    published.reserve(count);
+
+    auto start = Clock::now();
+    {
+        ResponsePublisher publisher{workload.db, buffered};
+        publisher.setZmqClient(&client, dbPersistence);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto &entry = workload.entries[i];
+            published.push_back(Clock::now());
+            publisher.publish(workload.table, kfvKey(entry), kfvFieldsValues(entry), ReturnCode(SAI_STATUS_SUCCESS));
+            if ((i + 1) % batch == 0 || i + 1 == count)
+            {
+                publisher.flush();
+            }
+        }
+
+        ASSERT_TRUE(receiver.wait(count));
+    }
+    auto total_usec = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+    std::vector<double> latencies;
+    latencies.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        latencies.push_back(std::chrono::duration<double, std::micro>(receiver.m_times[i] - published[i]).count());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p) {
+        return latencies[static_cast<size_t>(p * static_cast<double>(latencies.size() - 1) + 0.5)];
+    };
+
+    std::string mode = std::string(buffered ? "batched" : "single") + (dbPersistence ? "+db" : "");
+    std::cout << "[ PERF     ] " << std::left << std::setw(12) << workload.name << std::setw(11) << mode << std::right
+              << std::fixed << std::setprecision(3) << " entries " << count << " messages " << receiver.m_messages
+              << " time " << total_usec / 1000 << " ms"
+              << " throughput " << std::setprecision(0) << static_cast<double>(count) * 1000000 / total_usec << "/s"
+              << std::setprecision(3) << " p50 " << percentile(0.5) << " us"
+              << " p99 " << percentile(0.99) << " us" << std::endl;
+}
+
+} // namespace
+
+TEST(ResponsePublisherPerf, DashResponses)
+{
+    auto workload = getDashWorkload(getScale("RESPONSE_PUBLISHER_PERF_ENTRIES", 10000));
+
+    runWorkload(workload, "tcp://127.0.0.1:8120", /*buffered=*/false, /*dbPersistence=*/false);
+    runWorkload(workload, "tcp://127.0.0.1:8121", /*buffered=*/true, /*dbPersistence=*/false);
+    runWorkload(workload, "tcp://127.0.0.1:8122", /*buffered=*/true, /*dbPersistence=*/true);
+}
+
+TEST(ResponsePublisherPerf, P4rtResponses)
+{
+    auto workload = getP4rtWorkload(getScale("RESPONSE_PUBLISHER_PERF_ENTRIES", 10000));
+
+    runWorkload(workload, "tcp://127.0.0.1:8123", /*buffered=*/false, /*dbPersistence=*/false);
+    runWorkload(workload, "tcp://127.0.0.1:8124", /*buffered=*/true, /*dbPersistence=*/false);
+    runWorkload(workload, "tcp://127.0.0.1:8125", /*buffered=*/true, /*dbPersistence=*/true);
+}
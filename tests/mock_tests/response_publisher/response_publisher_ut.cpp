@@ -2,8 +2,51 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "zmqserver.h"
+
 using namespace swss;
 
+namespace
+{
+
+// Receives the responses sent over ZMQ, as the P4RT and DASH controllers do.
+class ResponseReceiver : public ZmqMessageHandler
+{
+  public:
+    void handleReceivedData(const std::vector<std::shared_ptr<KeyOpFieldsValuesTuple>> &kcos) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            for (const auto &kco : kcos)
+            {
+                m_responses.push_back(*kco);
+            }
+            m_messages++;
+        }
+        m_signal.notify_all();
+    }
+
+    // Waits until count responses were received.
+    bool wait(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        return m_signal.wait_for(lock, std::chrono::seconds(10), [&]() { return m_responses.size() >= count; });
+    }
+
+    std::vector<KeyOpFieldsValuesTuple> m_responses;
+    size_t m_messages = 0;
+
+  private:
+    std::mutex m_lock;
+    std::condition_variable m_signal;
+};
+
+} // namespace
+
 TEST(ResponsePublisher, TestPublish)
 {
     DBConnector conn{"APPL_STATE_DB", 0};
@@ -30,3 +73,72 @@ TEST(ResponsePublisher, TestPublishBuffered)
     ASSERT_TRUE(stateTable.hget("SOME_KEY", "field", value));
     ASSERT_EQ(value, "value");
 }
+
+TEST(ResponsePublisher, TestPublishZmq)
+{
+    DBConnector conn{"APPL_STATE_DB", 0};
+    Table stateTable{&conn, "SOME_TABLE"};
+    std::string value;
+    ResponseReceiver receiver;
+    ZmqServer server{"tcp://127.0.0.1:8110"};
+    server.registerMessageHandler("APPL_STATE_DB", "APPL_DB_SOME_TABLE_RESPONSE_CHANNEL", &receiver);
+    ZmqClient client{"tcp://127.0.0.1:8110"};
+    {
+        ResponsePublisher publisher{"APPL_STATE_DB"};
+        publisher.setZmqClient(&client);
+
+        publisher.publish("SOME_TABLE", "SOME_KEY", {{"field", "value"}}, ReturnCode(SAI_STATUS_SUCCESS));
+        ASSERT_TRUE(receiver.wait(1));
+    }
+
+    ASSERT_EQ(kfvKey(receiver.m_responses[0]), "SOME_KEY");
+    ASSERT_EQ(kfvOp(receiver.m_responses[0]), "SWSS_RC_SUCCESS");
+    ASSERT_EQ(kfvFieldsValues(receiver.m_responses[0]).size(), 2);
+    ASSERT_EQ(fvField(kfvFieldsValues(receiver.m_responses[0])[0]), "err_str");
+
+    // The state is written by the DB write thread, joined by the publisher destructor.
+    ASSERT_TRUE(stateTable.hget("SOME_KEY", "field", value));
+    ASSERT_EQ(value, "value");
+}
+
+TEST(ResponsePublisher, TestPublishZmqBuffered)
+{
+    ResponseReceiver receiver;
+    ZmqServer server{"tcp://127.0.0.1:8111"};
+    server.registerMessageHandler("APPL_STATE_DB", "APPL_DB_SOME_TABLE_RESPONSE_CHANNEL", &receiver);
+    ZmqClient client{"tcp://127.0.0.1:8111"};
+    ResponsePublisher publisher{"APPL_STATE_DB", /*buffered=*/true};
+    publisher.setZmqClient(&client);
+
+    publisher.publish("SOME_TABLE", "KEY1", {{"field", "value"}}, ReturnCode(SAI_STATUS_SUCCESS));
+    publisher.publish("SOME_TABLE", "KEY2", {{"field", "value"}}, ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM));
+    ASSERT_TRUE(receiver.m_responses.empty());
+
+    // The responses are sent in one batch.
+    publisher.flush();
+    ASSERT_TRUE(receiver.wait(2));
+    ASSERT_EQ(receiver.m_messages, 1);
+    ASSERT_EQ(kfvKey(receiver.m_responses[0]), "KEY1");
+    ASSERT_EQ(kfvKey(receiver.m_responses[1]), "KEY2");
+    ASSERT_EQ(kfvOp(receiver.m_responses[1]), "SWSS_RC_INVALID_PARAM");
+}
+
+TEST(ResponsePublisher, TestPublishZmqWithoutPersistence)
+{
+    DBConnector conn{"APPL_STATE_DB", 0};
+    Table stateTable{&conn, "SOME_TABLE"};
+    std::string value;
+    ResponseReceiver receiver;
+    ZmqServer server{"tcp://127.0.0.1:8112"};
+    server.registerMessageHandler("APPL_STATE_DB", "APPL_DB_SOME_TABLE_RESPONSE_CHANNEL", &receiver);
+    ZmqClient client{"tcp://127.0.0.1:8112"};
+    {
+        ResponsePublisher publisher{"APPL_STATE_DB"};
+        publisher.setZmqClient(&client, /*dbPersistence=*/false);
+
+        publisher.publish("SOME_TABLE", "ZMQ_ONLY_KEY", {{"field", "value"}}, ReturnCode(SAI_STATUS_SUCCESS));
+        ASSERT_TRUE(receiver.wait(1));
+    }
+
+    ASSERT_FALSE(stateTable.hget("ZMQ_ONLY_KEY", "field", value));
+}
@@ -524,6 +524,49 @@ namespace routeorch_test
         gMockResponsePublisher.reset();
     }
 
+    TEST_F(RouteOrchTest, RouteOrchTestInternedNextHopGroupKey)
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"2.2.2.0/24", "SET", { {"ifname", "Ethernet0,Ethernet0"},
+                                                  {"nexthop", "10.0.0.2,10.0.0.3"}}});
+        entries.push_back({"3.3.3.0/24", "SET", { {"ifname", "Ethernet0,Ethernet0"},
+                                                  {"nexthop", "10.0.0.2,10.0.0.3"}}});
+        entries.push_back({"4.4.4.0/24", "SET", { {"ifname", "Ethernet0,Ethernet0"},
+                                                  {"nexthop", "10.0.0.3,10.0.0.2"}}});
+        auto consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        // Routes with the same next hops share the next hop group key
+        const auto &routes = gRouteOrch->getSyncdRoutes().at(gVirtualRouterId);
+        const auto &nhg = routes.at(IpPrefix("2.2.2.0/24")).nhg_key;
+        ASSERT_EQ(nhg.getSize(), 2);
+        ASSERT_EQ(&nhg.getNextHops(), &routes.at(IpPrefix("3.3.3.0/24")).nhg_key.getNextHops());
+        ASSERT_EQ(&nhg.getNextHops(), &routes.at(IpPrefix("4.4.4.0/24")).nhg_key.getNextHops());
+        ASSERT_TRUE(gRouteOrch->hasNextHopGroup(nhg));
+
+        // Modifying a copy of the key doesn't modify the shared next hops
+        NextHopGroupKey copy = nhg;
+        copy.remove("10.0.0.3@Ethernet0");
+        ASSERT_EQ(copy.getSize(), 1);
+        ASSERT_EQ(nhg.getSize(), 2);
+        ASSERT_NE(copy, nhg);
+        ASSERT_TRUE(copy < nhg || nhg < copy);
+
+        // Keys parsed separately are ordered by the hash of their next hops like the interned keys
+        NextHopGroupKey parsed("10.0.0.3@Ethernet0,10.0.0.2@Ethernet0");
+        ASSERT_NE(&parsed.getNextHops(), &nhg.getNextHops());
+        ASSERT_EQ(parsed.getHash(), nhg.getHash());
+        ASSERT_EQ(parsed, nhg);
+        ASSERT_FALSE(parsed < nhg || nhg < parsed);
+        ASSERT_TRUE(gRouteOrch->hasNextHopGroup(parsed));
+
+        // The hash follows the modifications of the key
+        parsed.remove("10.0.0.3@Ethernet0");
+        ASSERT_EQ(parsed.getHash(), NextHopGroupKey("10.0.0.2@Ethernet0").getHash());
+        ASSERT_EQ(parsed, copy);
+    }
+
     TEST_F(RouteOrchTest, RouteOrchTestInvalidEvpnRoute)
     {
         std::deque<KeyOpFieldsValuesTuple> entries;
@@ -0,0 +1,143 @@
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "routetable.h"
+
+namespace routetable_test
+{
+    using namespace std;
+
+    static IpPrefix getPrefix(size_t index, bool v6)
+    {
+        if (v6)
+        {
+            return IpPrefix("2001:db8:" + to_string(index >> 16) + ":" + to_string(index & 0xffff) + "::/64");
+        }
+
+        return IpPrefix(to_string(10 + (index >> 16)) + "." + to_string((index >> 8) & 0xff) + "." +
+                        to_string(index & 0xff) + ".0/24");
+    }
+
+    TEST(RouteTableTest, SetFindErase)
+    {
+        RouteTable table;
+        RouteNhg nhg1(NextHopGroupKey("10.0.0.1@Ethernet0", ""), "");
+        RouteNhg nhg2(NextHopGroupKey("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4", ""), "");
+        RouteNhg nhg3(NextHopGroupKey(), "group1");
+
+        ASSERT_TRUE(table.empty());
+        ASSERT_EQ(table.find(IpPrefix("1.1.1.0/24")), nullptr);
+        ASSERT_THROW(table.at(IpPrefix("1.1.1.0/24")), std::out_of_range);
+
+        table.set(IpPrefix("1.1.1.0/24"), nhg1);
+        table.set(IpPrefix("1.1.1.0/25"), nhg2);
+        table.set(IpPrefix("2001::/64"), nhg3);
+        ASSERT_EQ(table.size(), 3);
+
+        // Prefixes are matched exactly, including the mask length and the family
+        ASSERT_EQ(table.at(IpPrefix("1.1.1.0/24")), nhg1);
+        ASSERT_EQ(table.at(IpPrefix("1.1.1.0/25")), nhg2);
+        ASSERT_EQ(table.at(IpPrefix("2001::/64")), nhg3);
+        ASSERT_FALSE(table.contains(IpPrefix("1.1.1.0/26")));
+        ASSERT_FALSE(table.contains(IpPrefix("2001::/65")));
+
+        // Replacing the next hop group of a route
+        table.set(IpPrefix("1.1.1.0/24"), nhg2);
+        ASSERT_EQ(table.size(), 3);
+        ASSERT_EQ(table.at(IpPrefix("1.1.1.0/24")), nhg2);
+        ASSERT_EQ(table.nhgCount(), 2);
+
+        ASSERT_TRUE(table.erase(IpPrefix("1.1.1.0/24")));
+        ASSERT_FALSE(table.erase(IpPrefix("1.1.1.0/24")));
+        ASSERT_TRUE(table.erase(IpPrefix("2001::/64")));
+        ASSERT_EQ(table.size(), 1);
+        ASSERT_EQ(table.nhgCount(), 1);
+        ASSERT_EQ(table.at(IpPrefix("1.1.1.0/25")), nhg2);
+    }
+
+    TEST(RouteTableTest, ManyRoutes)
+    {
+        const size_t count = 5000;
+        RouteTable table;
+        vector<RouteNhg> nhgs;
+
+        for (size_t i = 0; i < 8; i++)
+        {
+            nhgs.emplace_back(NextHopGroupKey("10.0.0." + to_string(i + 1) + "@Ethernet0", ""), "");
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            table.set(getPrefix(i, false), nhgs[i % nhgs.size()]);
+            table.set(getPrefix(i, true), nhgs[(i + 1) % nhgs.size()]);
+        }
+
+        ASSERT_EQ(table.size(), 2 * count);
+        ASSERT_EQ(table.nhgCount(), nhgs.size());
+
+        // Remove every other route to exercise the removal in the middle of probe sequences
+        for (size_t i = 0; i < count; i += 2)
+        {
+            ASSERT_TRUE(table.erase(getPrefix(i, false)));
+            ASSERT_TRUE(table.erase(getPrefix(i, true)));
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (i % 2 == 0)
+            {
+                ASSERT_FALSE(table.contains(getPrefix(i, false)));
+                ASSERT_FALSE(table.contains(getPrefix(i, true)));
+            }
+            else
+            {
+                ASSERT_EQ(table.at(getPrefix(i, false)), nhgs[i % nhgs.size()]);
+                ASSERT_EQ(table.at(getPrefix(i, true)), nhgs[(i + 1) % nhgs.size()]);
+            }
+        }
+
+        // Iteration visits every route once
+        set<IpPrefix> visited;
+        for (const auto &route : table)
+        {
+            ASSERT_TRUE(visited.insert(route.first).second);
+            ASSERT_EQ(route.second, table.at(route.first));
+        }
+        ASSERT_EQ(visited.size(), table.size());
+
+        // A route takes less than a std::map node holding the prefix and the next hop group
+        ASSERT_LT(table.getMemoryUsage() / table.size(), 4 * sizeof(void *) + sizeof(IpPrefix) + sizeof(RouteNhg));
+    }
+
+    TEST(RouteTableTest, CoveringRoutes)
+    {
+        RouteTable table;
+        RouteNhg nhg(NextHopGroupKey("10.0.0.1@Ethernet0", ""), "");
+
+        for (auto prefix : { "0.0.0.0/0", "10.0.0.0/8", "10.1.0.0/16", "10.1.2.0/24", "10.1.3.0/24",
+                             "10.1.2.3/32", "::/0", "2001:db8::/32", "2001:db8:0:1::/64", "2001:db8:0:2::/64" })
+        {
+            table.set(IpPrefix(prefix), nhg);
+        }
+
+        auto getCovering = [&table](const string &addr)
+        {
+            vector<string> prefixes;
+            table.forEachCoveringRoute(IpAddress(addr), [&prefixes](const IpPrefix &prefix, const RouteNhg &)
+            {
+                prefixes.push_back(prefix.to_string());
+            });
+            return prefixes;
+        };
+
+        // Covering routes are visited from the shortest to the longest prefix
+        ASSERT_EQ(getCovering("10.1.2.3"), vector<string>({ "0.0.0.0/0", "10.0.0.0/8", "10.1.0.0/16", "10.1.2.0/24", "10.1.2.3/32" }));
+        ASSERT_EQ(getCovering("10.1.2.4"), vector<string>({ "0.0.0.0/0", "10.0.0.0/8", "10.1.0.0/16", "10.1.2.0/24" }));
+        ASSERT_EQ(getCovering("10.2.0.1"), vector<string>({ "0.0.0.0/0", "10.0.0.0/8" }));
+        ASSERT_EQ(getCovering("2001:db8:0:1::5"), vector<string>({ "::/0", "2001:db8::/32", "2001:db8:0:1::/64" }));
+        ASSERT_EQ(getCovering("2001:db9::1"), vector<string>({ "::/0" }));
+
+        table.erase(IpPrefix("10.1.2.3/32"));
+        table.erase(IpPrefix("0.0.0.0/0"));
+        ASSERT_EQ(getCovering("10.1.2.3"), vector<string>({ "10.0.0.0/8", "10.1.0.0/16", "10.1.2.0/24" }));
+    }
+}
@@ -0,0 +1,128 @@
+#include "ut_helper.h"
+#include "statewriter.h"
+
+namespace statewriter_test
+{
+    using namespace std;
+
+    struct StateWriterTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_state_db;
+        shared_ptr<swss::Table> m_table;
+
+        void SetUp() override
+        {
+            ::testing_db::reset();
+
+            m_state_db = make_shared<swss::DBConnector>("STATE_DB", 0);
+            m_table = make_shared<swss::Table>(m_state_db.get(), "TEST_STATE_TABLE");
+        }
+
+        void TearDown() override
+        {
+            ::testing_db::reset();
+        }
+
+        string hget(const string &key, const string &field)
+        {
+            string value;
+            m_table->hget(key, field, value);
+            return value;
+        }
+    };
+
+    TEST_F(StateWriterTest, SetIsWrittenOnFlush)
+    {
+        StateWriter writer;
+
+        writer.set(m_state_db.get(), "TEST_STATE_TABLE", "key1", { { "state", "active" } });
+        ASSERT_EQ(writer.getPendingCount(), 1);
+
+        vector<string> keys;
+        m_table->getKeys(keys);
+        ASSERT_TRUE(keys.empty());
+
+        ASSERT_EQ(writer.flush(), 1);
+        ASSERT_EQ(writer.getPendingCount(), 0);
+        ASSERT_EQ(hget("key1", "state"), "active");
+
+        // Nothing left to write
+        ASSERT_EQ(writer.flush(), 0);
+    }
+
+    TEST_F(StateWriterTest, SetsAreMerged)
+    {
+        StateWriter writer;
+
+        writer.set(m_state_db.get(), "TEST_STATE_TABLE", "key1", { { "state", "inactive" }, { "status", "ok" } });
+        writer.set(m_state_db.get(), "TEST_STATE_TABLE", "key1", { { "state", "active" } });
+        writer.set(m_state_db.get(), "TEST_STATE_TABLE", "key2", { { "state", "active" } });
+
+        ASSERT_EQ(writer.getPendingCount(), 2);
+        ASSERT_EQ(writer.getWriteCount(), 3);
+        ASSERT_EQ(writer.getCoalescedCount(), 1);
+
+        ASSERT_EQ(writer.flush(), 2);
+        ASSERT_EQ(hget("key1", "state"), "active");
+        ASSERT_EQ(hget("key1", "status"), "ok");
+        ASSERT_EQ(hget("key2", "state"), "active");
+    }
+
+    TEST_F(StateWriterTest, ManyFieldsAreMerged)
+    {
+        StateWriter writer;
+
+        // Each field is set several times, the last value of each field is written once
+        for (int round = 0; round < 3; round++)
+        {
+            for (int i = 0; i < 100; i++)
+            {
+                writer.set(m_state_db.get(), "TEST_STATE_TABLE", "key1",
+                           { { "field" + to_string(i), to_string(round) } });
+            }
+        }
+        ASSERT_EQ(writer.getPendingCount(), 1);
+
+        ASSERT_EQ(writer.flush(), 1);
+
+        vector<swss::FieldValueTuple> values;
+        ASSERT_TRUE(m_table->get("key1", values));
+        ASSERT_EQ(values.size(), 100u);
+        ASSERT_EQ(hget("key1", "field0"), "2");
+        ASSERT_EQ(hget("key1", "field99"), "2");
+    }
+
+    TEST_F(StateWriterTest, DelAfterSet)
+    {
+        StateWriter writer;
+
+        m_table->set("key1", { { "state", "active" } });
+
+        writer.set(m_state_db.get(), "TEST_STATE_TABLE", "key1", { { "state", "inactive" } });
+        writer.del(m_state_db.get(), "TEST_STATE_TABLE", "key1");
+        ASSERT_EQ(writer.getPendingCount(), 1);
+
+        ASSERT_EQ(writer.flush(), 1);
+
+        string value;
+        ASSERT_FALSE(m_table->hget("key1", "state", value));
+    }
+
+    TEST_F(StateWriterTest, SetAfterDel)
+    {
+        StateWriter writer;
+
+        // The fields of the deleted key are not kept
+        m_table->set("key1", { { "state", "active" }, { "status", "ok" } });
+
+        writer.del(m_state_db.get(), "TEST_STATE_TABLE", "key1");
+        writer.set(m_state_db.get(), "TEST_STATE_TABLE", "key1", { { "state", "inactive" } });
+        ASSERT_EQ(writer.getCoalescedCount(), 1);
+
+        ASSERT_EQ(writer.flush(), 1);
+
+        string value;
+        ASSERT_EQ(hget("key1", "state"), "inactive");
+        ASSERT_FALSE(m_table->hget("key1", "status", value));
+    }
+}
@@ -8,6 +8,7 @@
 #include "mock_orchagent_main.h"
 #include "mock_table.h"
 #include "mock_response_publisher.h"
+#include <iomanip>
 
 extern void on_switch_asic_sdk_health_event(sai_object_id_t switch_id,
                                             sai_switch_asic_sdk_health_severity_t severity,
@@ -236,6 +237,95 @@ namespace switchorch_test
         _unhook_sai_apis();
     }
 
+    TEST_F(SwitchOrchTest, SwitchOrchTestEliminateEvents)
+    {
+        sai_switch_health_data_t data = {.data_type = SAI_HEALTH_DATA_TYPE_GENERAL};
+        vector<uint8_t> data_from_sai({101, 118, 101, 110, 116});
+        sai_u8_list_t description;
+        description.list = data_from_sai.data();
+        description.count = (uint32_t)data_from_sai.size();
+
+        auto eventKey = [](time_t t) {
+            stringstream time_ss;
+            time_ss << std::put_time(std::localtime(&t), "%Y-%m-%d %H:%M:%S");
+            return time_ss.str();
+        };
+
+        // An event recorded before orchagent started
+        Table eventTable = Table(m_state_db.get(), STATE_ASIC_SDK_HEALTH_EVENT_TABLE_NAME);
+        eventTable.set(eventKey(1701160400),
+                       {
+                           {"severity", "fatal"},
+                           {"category", "software"},
+                           {"description", "event"}
+                       });
+
+        _ut_stub_asic_sdk_health_event_check_all = true;
+        _hook_sai_apis();
+        initSwitchOrch();
+        ASSERT_NE(gSwitchOrch->m_eliminateEventsTimer, nullptr);
+
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"fatal", "SET",
+                           {
+                               {"max_events", "2"}
+                           }});
+        entries.push_back({"warning", "SET",
+                           {
+                               {"max_events", "2"}
+                           }});
+        auto consumer = dynamic_cast<Consumer *>(gSwitchOrch->getExecutor(CFG_SUPPRESS_ASIC_SDK_HEALTH_EVENT_NAME));
+        consumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gSwitchOrch)->doTask();
+
+        for (time_t t = 1701160447; t < 1701160450; t++)
+        {
+            sai_timespec_t timestamp = {.tv_sec = (uint64_t)t, .tv_nsec = 0};
+            on_switch_asic_sdk_health_event(gSwitchId,
+                                            SAI_SWITCH_ASIC_SDK_HEALTH_SEVERITY_FATAL,
+                                            timestamp,
+                                            SAI_SWITCH_ASIC_SDK_HEALTH_CATEGORY_FW,
+                                            data,
+                                            description);
+        }
+        sai_timespec_t timestamp = {.tv_sec = 1701160450, .tv_nsec = 0};
+        on_switch_asic_sdk_health_event(gSwitchId,
+                                        SAI_SWITCH_ASIC_SDK_HEALTH_SEVERITY_WARNING,
+                                        timestamp,
+                                        SAI_SWITCH_ASIC_SDK_HEALTH_CATEGORY_FW,
+                                        data,
+                                        description);
+
+        // The two oldest fatal events are eliminated, the warning event is not exceeding the maximum
+        gSwitchOrch->doTask(*gSwitchOrch->m_eliminateEventsTimer);
+
+        vector<string> keys;
+        eventTable.getKeys(keys);
+        sort(keys.begin(), keys.end());
+        ASSERT_EQ(keys, vector<string>({eventKey(1701160448), eventKey(1701160449), eventKey(1701160450)}));
+
+        // No more limit for the fatal events once max_events is removed
+        entries.push_back({"fatal", "DEL", {}});
+        consumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gSwitchOrch)->doTask();
+
+        timestamp = {.tv_sec = 1701160451, .tv_nsec = 0};
+        on_switch_asic_sdk_health_event(gSwitchId,
+                                        SAI_SWITCH_ASIC_SDK_HEALTH_SEVERITY_FATAL,
+                                        timestamp,
+                                        SAI_SWITCH_ASIC_SDK_HEALTH_CATEGORY_FW,
+                                        data,
+                                        description);
+        gSwitchOrch->doTask(*gSwitchOrch->m_eliminateEventsTimer);
+
+        eventTable.getKeys(keys);
+        ASSERT_EQ(keys.size(), 4);
+
+        _unhook_sai_apis();
+    }
+
     TEST_F(SwitchOrchTest, SwitchOrchTestCheckCapability)
     {
         initSwitchOrch();
@@ -913,6 +913,185 @@ namespace twamporch_test
         ASSERT_EQ(current_set_count + 2, set_twamp_session_count);
     }
 
+    TEST_F(TwampOrchTest, TwampOrchTestLatencyPercentiles)
+    {
+        string twampSessionName = "TEST_SENDER1";
+
+        MockTwampOrch twampOrch;
+
+        // Create and start TWAMP Light session
+        {
+            std::deque<KeyOpFieldsValuesTuple> tableKofvt;
+            tableKofvt.push_back(
+                {
+                    twampSessionName,
+                    SET_COMMAND,
+                    {
+                        {"mode",                "LIGHT"   },
+                        {"role",                "SENDER"  },
+                        {"src_ip",              "1.1.1.1" },
+                        {"src_udp_port",        "862"     },
+                        {"dst_ip",              "2.2.2.2" },
+                        {"dst_udp_port",        "863"     },
+                        {"packet_count",        "10000"   },
+                        {"tx_interval",         "10"      },
+                        {"timeout",             "10"      },
+                        {"statistics_interval", "1000"    }
+                    }
+                }
+            );
+            tableKofvt.push_back(
+                {
+                    twampSessionName,
+                    SET_COMMAND,
+                    {
+                        {"admin_state", "enabled"}
+                    }
+                }
+            );
+
+            twampOrch.doTwampTableTask(tableKofvt);
+
+            string session_status;
+            ASSERT_TRUE(twampOrch.get().getSessionStatus(twampSessionName, session_status));
+            ASSERT_EQ(session_status, "active");
+        }
+
+        // 98 intervals at 1000 and 2 intervals at 50000 latency, 100 packets each
+        {
+            sai_twamp_session_event_notification_data_t twamp_session_data;
+            sai_twamp_session_stat_t counters_ids[SAI_TWAMP_SESSION_STAT_DURATION_TS];
+            uint64_t counters[SAI_TWAMP_SESSION_STAT_DURATION_TS];
+            twamp_session_data.twamp_session_id = (sai_object_id_t)0x1;
+            twamp_session_data.session_state = SAI_TWAMP_SESSION_STATE_ACTIVE;
+            twamp_session_data.session_stats.number_of_counters = 11;
+            for (uint32_t j = 0; j < 11; j++)
+            {
+                counters_ids[j] = (sai_twamp_session_stat_t)(SAI_TWAMP_SESSION_STAT_RX_PACKETS + j);
+            }
+            twamp_session_data.session_stats.counters_ids = counters_ids;
+            twamp_session_data.session_stats.counters = counters;
+
+            for (uint32_t i = 1; i <= 100; i++)
+            {
+                mockReply = (redisReply *)calloc(sizeof(redisReply), 1);
+                mockReply->type = REDIS_REPLY_ARRAY;
+                mockReply->elements = 3; // REDIS_PUBLISH_MESSAGE_ELEMNTS
+                mockReply->element = (redisReply **)calloc(sizeof(redisReply *), mockReply->elements);
+                mockReply->element[2] = (redisReply *)calloc(sizeof(redisReply), 1);
+                mockReply->element[2]->type = REDIS_REPLY_STRING;
+
+                uint64_t latency = (i <= 98) ? 1000 : 50000;
+                twamp_session_data.session_stats.index = i;
+                counters[SAI_TWAMP_SESSION_STAT_RX_PACKETS] = 100;
+                counters[SAI_TWAMP_SESSION_STAT_RX_BYTE] = 10000;
+                counters[SAI_TWAMP_SESSION_STAT_TX_PACKETS] = 100;
+                counters[SAI_TWAMP_SESSION_STAT_TX_BYTE] = 10000;
+                counters[SAI_TWAMP_SESSION_STAT_DROP_PACKETS] = 0;
+                counters[SAI_TWAMP_SESSION_STAT_MAX_LATENCY] = latency;
+                counters[SAI_TWAMP_SESSION_STAT_MIN_LATENCY] = latency;
+                counters[SAI_TWAMP_SESSION_STAT_AVG_LATENCY] = latency;
+                counters[SAI_TWAMP_SESSION_STAT_MAX_JITTER] = 100;
+                counters[SAI_TWAMP_SESSION_STAT_MIN_JITTER] = 100;
+                counters[SAI_TWAMP_SESSION_STAT_AVG_JITTER] = 100;
+
+                std::string data = sai_serialize_twamp_session_event_ntf(1, &twamp_session_data);
+
+                std::vector<FieldValueTuple> notifyValues;
+                FieldValueTuple opdata("twamp_session_event", data);
+                notifyValues.push_back(opdata);
+                std::string msg = swss::JSon::buildJson(notifyValues);
+                mockReply->element[2]->str = (char*)calloc(1, msg.length() + 1);
+                memcpy(mockReply->element[2]->str, msg.c_str(), msg.length());
+
+                twampOrch.doTwampNotificationTask();
+                mockReply = nullptr;
+            }
+        }
+
+        // Percentiles and raw buckets are published to COUNTERS_DB
+        {
+            TwampStatsTable twampStatistics = Portal::TwampOrchInternal::getTwampSessionStatistics(twampOrch.get());
+            ASSERT_EQ(twampStatistics[twampSessionName].latency_histogram.total, 10000);
+            ASSERT_EQ(twampStatistics[twampSessionName].jitter_histogram.total, 10000);
+
+            Table countersTable(countersDb.get(), COUNTERS_TABLE);
+            string key = sai_serialize_object_id((sai_object_id_t)0x1);
+            string value;
+
+            ASSERT_TRUE(countersTable.hget(key, "LATENCY_EST_P50", value));
+            ASSERT_EQ(value, "1023");
+            ASSERT_TRUE(countersTable.hget(key, "LATENCY_EST_P99", value));
+            ASSERT_EQ(value, "50000");
+            ASSERT_TRUE(countersTable.hget(key, "LATENCY_EST_P999", value));
+            ASSERT_EQ(value, "50000");
+            ASSERT_TRUE(countersTable.hget(key, "JITTER_EST_P50", value));
+            ASSERT_EQ(value, "100");
+            ASSERT_TRUE(countersTable.hget(key, "JITTER_EST_P999", value));
+            ASSERT_EQ(value, "100");
+            ASSERT_TRUE(countersTable.hget(key, "SAI_TWAMP_SESSION_STAT_AVG_LATENCY", value));
+            ASSERT_EQ(value, to_string((98 * 1000 + 2 * 50000) / 100));
+
+            ASSERT_TRUE(countersTable.hget(key + ":LATENCY_HISTOGRAM", "1023", value));
+            ASSERT_EQ(value, "9800");
+            ASSERT_TRUE(countersTable.hget(key + ":LATENCY_HISTOGRAM", "53247", value));
+            ASSERT_EQ(value, "200");
+            ASSERT_TRUE(countersTable.hget(key + ":JITTER_HISTOGRAM", "103", value));
+            ASSERT_EQ(value, "10000");
+        }
+
+        // Delete TWAMP Light session
+        {
+            std::deque<KeyOpFieldsValuesTuple> tableKofvt;
+            tableKofvt.push_back(
+                {
+                    twampSessionName,
+                    DEL_COMMAND,
+                    { {} }
+                }
+            );
+
+            twampOrch.doTwampTableTask(tableKofvt);
+
+            string session_status;
+            ASSERT_FALSE(twampOrch.get().getSessionStatus(twampSessionName, session_status));
+        }
+    }
+
+    TEST(TwampHistogramTest, Buckets)
+    {
+        TwampHistogram histogram;
+        histogram.reset();
+
+        // Small values are counted exactly, larger values within 1/8 of their bucket bound
+        for (uint64_t value : { 0ULL, 1ULL, 7ULL, 8ULL, 15ULL, 16ULL, 17ULL, 1000ULL, 123456789ULL, (1ULL << 39) + 1 })
+        {
+            uint32_t bucket = TwampHistogram::getBucket(value);
+            uint64_t upper = TwampHistogram::getBucketUpperBound(bucket);
+            ASSERT_GE(upper, value);
+            ASSERT_LE(upper - value, value / 8);
+            if (bucket > 0)
+            {
+                ASSERT_LT(TwampHistogram::getBucketUpperBound(bucket - 1), value);
+            }
+        }
+        ASSERT_EQ(TwampHistogram::getBucket(UINT64_MAX), TWAMP_HISTOGRAM_BUCKETS - 1);
+
+        ASSERT_EQ(histogram.getPercentile(0.5), 0);
+        for (uint64_t value = 1; value <= 1000; value++)
+        {
+            histogram.record(value, 1);
+        }
+        ASSERT_EQ(histogram.total, 1000);
+        ASSERT_EQ(histogram.min, 1);
+        ASSERT_EQ(histogram.max, 1000);
+        ASSERT_GE(histogram.getPercentile(0.5), 500);
+        ASSERT_LE(histogram.getPercentile(0.5), 500 + 500 / 8);
+        ASSERT_GE(histogram.getPercentile(0.99), 990);
+        ASSERT_LE(histogram.getPercentile(0.999), 1000);
+        ASSERT_EQ(histogram.getPercentile(1.0), 1000);
+    }
+
     TEST_F(TwampOrchTest, TwampOrchTestCreateDeleteReflector)
     {
         string twampSessionName = "TEST_SENDER1";
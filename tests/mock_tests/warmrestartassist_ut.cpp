@@ -33,21 +33,23 @@ namespace warmrestartassist_test
         void SetUp() override
         {
             testing_db::reset();
-
-            Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
-            testTable.set("key",
-                          {
-                              {"field", "value0"},
-                          });
         }
 
         void TearDown() override
         {
+            delete appRestartAssist;
+            appRestartAssist = nullptr;
         }
     };
 
     TEST_F(WarmrestartassistTest, warmRestartAssistTest)
     {
+        Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
+        testTable.set("key",
+                      {
+                          {"field", "value0"},
+                      });
+
         appRestartAssist->readTablesToMap();
         vector<FieldValueTuple> fvVector;
         fvVector.emplace_back("field", "value1");
@@ -56,9 +58,59 @@ namespace warmrestartassist_test
         appRestartAssist->reconcile();
 
         fvVector.clear();
-        Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
         ASSERT_TRUE(testTable.get("key", fvVector));
         ASSERT_EQ(fvField(fvVector[0]), "field");
         ASSERT_EQ(fvValue(fvVector[0]), "value1");
     }
+
+    TEST_F(WarmrestartassistTest, incrementalReconcileTest)
+    {
+        Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
+        testTable.set("same_key", { {"field", "value0"} });
+        testTable.set("stale_key", { {"field", "value0"} });
+        testTable.set("deleted_key", { {"field", "value0"} });
+        testTable.set("updated_key", { {"field", "value0"}, {"other", "value0"} });
+
+        appRestartAssist->setIncrementalReconcile(true);
+        appRestartAssist->readTablesToMap();
+
+        // Same value, or a subset of the restored fields
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "same_key", { {"field", "value0"} }, false);
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "updated_key", { {"other", "value0"} }, false);
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "updated_key", { {"field", "value1"} }, false);
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "new_key", { {"field", "value1"} }, false);
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "deleted_key", {}, true);
+
+        // New entries are written before the reconciliation, deleted entries are not
+        vector<FieldValueTuple> fvVector;
+        ASSERT_TRUE(testTable.get("new_key", fvVector));
+        ASSERT_EQ(fvValue(fvVector[0]), "value1");
+        ASSERT_TRUE(testTable.get("deleted_key", fvVector));
+
+        appRestartAssist->reconcile();
+
+        ASSERT_TRUE(testTable.get("same_key", fvVector));
+        ASSERT_TRUE(testTable.get("new_key", fvVector));
+        ASSERT_FALSE(testTable.get("stale_key", fvVector));
+        ASSERT_FALSE(testTable.get("deleted_key", fvVector));
+        string value;
+        ASSERT_TRUE(testTable.hget("updated_key", "field", value));
+        ASSERT_EQ(value, "value1");
+
+        auto state_db = make_shared<swss::DBConnector>("STATE_DB", 0);
+        Table warmRestartTable = Table(state_db.get(), STATE_WARM_RESTART_TABLE_NAME);
+        map<string, string> stats;
+        ASSERT_TRUE(warmRestartTable.get("testsyncd", fvVector));
+        for (const auto &fv : fvVector)
+        {
+            stats[fvField(fv)] = fvValue(fv);
+        }
+        // same_key, stale_key, deleted_key and updated_key
+        ASSERT_EQ(stats["restored_entries"], "4");
+        ASSERT_EQ(stats["same_entries"], "1");
+        ASSERT_EQ(stats["new_entries"], "2");
+        ASSERT_EQ(stats["stale_entries"], "1");
+        ASSERT_EQ(stats["deleted_entries"], "1");
+        ASSERT_EQ(stats["streamed_entries"], "2");
+    }
 }
@@ -1,6 +1,7 @@
 #include <csignal>
 #include <iostream>
 #include <deque>
+#include <chrono>
 
 #include <logger.h>
 #include <select.h>
@@ -51,6 +52,32 @@ void update_interfaces(swss::SubscriberStateTable & table, TeamdCtlMgr & mgr)
     }
 }
 
+///
+/// Collect dumps from all teamds and update the values in the db.
+/// Collection and processing latencies are reported to the log
+///
+/// @param mgr      reference to the TeamdCtlMgr
+/// @param store    reference to the ValuesStore
+/// @param to_retry whether get_dumps should retry on failures
+///
+void update_values(TeamdCtlMgr & mgr, ValuesStore & store, bool to_retry)
+{
+    using namespace std::chrono;
+
+    const auto start = steady_clock::now();
+    const auto & dumps = mgr.get_dumps(to_retry);
+    const auto collected = steady_clock::now();
+    store.update(dumps);
+    const auto stored = steady_clock::now();
+
+    const auto & stats = store.get_last_stats();
+    SWSS_LOG_INFO("Collected %zu dumps in %ld us, processed in %ld us: %zu parsed, %zu fields written, %zu keys removed",
+                  stats.dumps,
+                  static_cast<long>(duration_cast<microseconds>(collected - start).count()),
+                  static_cast<long>(duration_cast<microseconds>(stored - collected).count()),
+                  stats.parsed, stats.fields_written, stats.keys_removed);
+}
+
 ///
 /// Signal handler
 ///
@@ -104,7 +131,7 @@ int main()
             if (res == swss::Select::OBJECT)
             {
                 update_interfaces(sst_lag, teamdctl_mgr);
-                values_store.update(teamdctl_mgr.get_dumps(false));
+                update_values(teamdctl_mgr, values_store, false);
             }
             else if (res == swss::Select::ERROR)
             {
@@ -117,7 +144,7 @@ int main()
                 // In the case of lag removal, there is a scenario where the select::TIMEOUT
                 // occurs, it triggers get_dumps incorrectly for resource which was in process of 
                 // getting deleted. The fix here is to retry and check if this is a real failure.
-                values_store.update(teamdctl_mgr.get_dumps(true));
+                update_values(teamdctl_mgr, values_store, true);
             }
             else
             {
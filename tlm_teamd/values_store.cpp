@@ -203,40 +203,71 @@ json_t * ValuesStore::load_json(const std::string & data)
 
 ///
 /// Convert json input from all teamds to the temporary storage
+/// The dumps which are the same as the last stored ones are not parsed.
 /// @param dumps dumps from all teamds. It is a vector of pairs. Each pair
 ///              has a first element - name of the LAG and a second element
 ///              - json dump
-/// @return temporary storage
+/// @param unchanged_lags a set which is filled with names of LAGs with unchanged dumps
+/// @return temporary storage for LAGs with changed dumps
 ///
-HashOfRecords ValuesStore::from_json(const std::vector<StringPair> & dumps)
+HashOfRecords ValuesStore::from_json(const std::vector<StringPair> & dumps, LagNames & unchanged_lags)
 {
     HashOfRecords storage;
     for (const auto & p: dumps)
     {
         const auto & lag_name = p.first;
         const auto & json_dump = p.second;
+        const auto & last_dump = m_dumps.find(lag_name);
+        if (last_dump != m_dumps.end() && last_dump->second == json_dump)
+        {
+            unchanged_lags.insert(lag_name);
+            continue;
+        }
         json_t * root = load_json(json_dump);
-        extract_values(lag_name, root, storage);
+        try
+        {
+            extract_values(lag_name, root, storage);
+        }
+        catch (...)
+        {
+            json_decref(root);
+            throw;
+        }
         json_decref(root);
+        m_last_stats.parsed++;
     }
 
     return storage;
 }
 
+///
+/// Extract a name of the LAG from a database key
+/// For example "LAG_MEMBER_TABLE|PortChannel1|Ethernet0" would return "PortChannel1"
+/// @param key a database key.
+/// @return a name of the LAG
+///
+std::string ValuesStore::get_lag_name(const std::string & key)
+{
+    const auto & entry_key = split_key(key).second;
+    return entry_key.substr(0, entry_key.find('|'));
+}
+
 ///
 /// Extract a list of stale keys from the storage.
 /// The stale key is a key which a presented in the storage, but not presented
-/// in the temporary storage. That means that the key must be removed
+/// in the temporary storage, and doesn't belong to a LAG with unchanged dump.
+/// That means that the key must be removed
 /// @param storage a reference to the temporary storage
+/// @param unchanged_lags a set of LAGs with unchanged dumps
 /// @return list of stale keys
 ///
-std::vector<std::string> ValuesStore::get_old_keys(const HashOfRecords & storage)
+std::vector<std::string> ValuesStore::get_old_keys(const HashOfRecords & storage, const LagNames & unchanged_lags)
 {
     std::vector<std::string> old_keys;
     for (const auto & p: m_storage)
     {
         const auto & db_key = p.first;
-        if (storage.find(db_key) == storage.end())
+        if (storage.find(db_key) == storage.end() && unchanged_lags.find(get_lag_name(db_key)) == unchanged_lags.end())
         {
             old_keys.push_back(db_key);
         }
@@ -270,8 +301,25 @@ StringPair ValuesStore::split_key(const std::string & key)
     return std::make_pair(key.substr(0, sep_pos), key.substr(sep_pos + 1));
 }
 
+///
+/// Get a buffered table on the pipeline. The tables are created on demand.
+/// @param table_name a name of the table
+/// @return a reference to the table
+///
+swss::Table & ValuesStore::get_table(const std::string & table_name)
+{
+    auto & table = m_tables[table_name];
+    if (!table)
+    {
+        table = std::make_unique<swss::Table>(&m_pipeline, table_name, true);
+    }
+
+    return *table;
+}
+
 ///
 /// Remove keys from the db
+/// The removal is buffered in the pipeline until update_db() is called
 /// @param keys a list of keys to remove
 ///
 void ValuesStore::remove_keys_db(const std::vector<std::string> & keys)
@@ -281,8 +329,8 @@ void ValuesStore::remove_keys_db(const std::vector<std::string> & keys)
         const auto & p = split_key(key);
         const auto & table_name = p.first;
         const auto & table_key = p.second;
-        swss::Table table(m_db, table_name);
-        table.del(table_key);
+        get_table(table_name).del(table_key);
+        m_last_stats.keys_removed++;
     }
 }
 
@@ -290,89 +338,105 @@ void ValuesStore::remove_keys_db(const std::vector<std::string> & keys)
 /// Update the storage with values from the temporary storage
 /// The update is the following:
 /// 1. For each key in the temporary storage we check that we have that key in the storage
-/// 2. if not, we insert the key and value to the storage
-/// 3. if yes, we check that value of the key is not changed. If the value is changed we
-///    replace that value with the value from the temporary storage
-/// This method returns a list of keys which should be updated in the database
+/// 2. if not, we insert the key and value to the storage, and all its values are changed
+/// 3. if yes, we check which values of the key are changed and replace them
+///    with the values from the temporary storage
+/// This method returns changed values which should be updated in the database
 /// @param storage the temporary storage
-/// @retorun a list of keys which must be updated in the storage
+/// @return changed values which must be updated in the database
 ///
-std::vector<std::string> ValuesStore::update_storage(const HashOfRecords & storage)
+HashOfRecords ValuesStore::update_storage(const HashOfRecords & storage)
 {
-    std::vector<std::string> to_update;
+    HashOfRecords changes;
 
     for (const auto & entry_pair: storage)
     {
         const auto & entry_key    = entry_pair.first;
         const auto & entry_values = entry_pair.second;
-        if (m_storage.find(entry_key) == m_storage.end())
+        const auto & stored = m_storage.find(entry_key);
+        if (stored == m_storage.end())
         {
             m_storage.emplace(entry_pair);
-            to_update.emplace_back(entry_key);
+            changes.emplace(entry_pair);
         }
         else
         {
-            bool is_changed = false;
+            auto & stored_values = stored->second;
             for (const auto & row_pair: entry_values)
             {
                 const auto & row_key   = row_pair.first;
                 const auto & row_value = row_pair.second;
-                if (m_storage[entry_key][row_key] != row_value)
+                auto & stored_value = stored_values[row_key];
+                if (stored_value != row_value)
                 {
-                    is_changed = true;
-                    break;
+                    stored_value = row_value;
+                    changes[entry_key].emplace(row_pair);
                 }
             }
-
-            if (is_changed)
-            {
-                m_storage.erase(entry_key);
-                m_storage.emplace(entry_pair);
-                to_update.emplace_back(entry_key);
-            }
         }
     }
 
-    return to_update;
+    return changes;
 }
 
 ///
-/// Update values in the db with values from the temporary storage
-/// @param storage a reference to the temporary storage
-/// @param keys_to_refresh a list of keys which must be refreshed in the db
+/// Update changed values in the db and flush all buffered operations in one batch
+/// @param changes changed values which must be refreshed in the db
 ///
-void ValuesStore::update_db(const HashOfRecords & storage, const std::vector<std::string> & keys_to_refresh)
+void ValuesStore::update_db(const HashOfRecords & changes)
 {
-    for (const auto & key: keys_to_refresh)
+    for (const auto & entry_pair: changes)
     {
         std::vector<swss::FieldValueTuple> fvp;
-        for (const auto & row_pair: storage.at(key))
+        for (const auto & row_pair: entry_pair.second)
         {
             fvp.emplace_back(row_pair);
         }
-        const auto & table_pair = split_key(key);
-        swss::Table table(m_db, table_pair.first);
-        table.set(table_pair.second, fvp);
+        m_last_stats.fields_written += fvp.size();
+        const auto & table_pair = split_key(entry_pair.first);
+        get_table(table_pair.first).set(table_pair.second, fvp);
     }
+
+    m_pipeline.flush();
 }
 
+///
+/// Remember the dumps which have been stored, to skip them next time if they aren't changed
+/// @param dumps dumps from all teamds
+///
+void ValuesStore::update_dumps(const std::vector<StringPair> & dumps)
+{
+    std::unordered_map<std::string, std::string> new_dumps;
+    for (const auto & p: dumps)
+    {
+        new_dumps.emplace(p);
+    }
+    m_dumps.swap(new_dumps);
+}
 
 ///
 /// Update the storage with json dumps for every registered LAG interface.
 ///
 void ValuesStore::update(const std::vector<StringPair> & dumps)
 {
+    m_last_stats = ValuesStoreStats();
+    m_last_stats.dumps = dumps.size();
+
     try
     {
-        const auto & storage = from_json(dumps);
-        const auto & old_keys = get_old_keys(storage);
+        LagNames unchanged_lags;
+        const auto & storage = from_json(dumps, unchanged_lags);
+        const auto & old_keys = get_old_keys(storage, unchanged_lags);
         remove_keys_db(old_keys);
         remove_keys_storage(old_keys);
-        const auto & keys_to_refresh = update_storage(storage);
-        update_db(storage, keys_to_refresh);
+        const auto & changes = update_storage(storage);
+        update_db(changes);
+        update_dumps(dumps);
     }
     catch (const std::exception & e)
     {
         SWSS_LOG_WARN("Exception '%s' had been thrown in ValuesStore", e.what());
+        // Parse every dump again next time, as the storage could be updated partially
+        m_dumps.clear();
     }
 }
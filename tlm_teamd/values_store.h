@@ -2,20 +2,35 @@
 
 #include <string>
 #include <vector>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <jansson.h>
 
 #include <dbconnector.h>
+#include <redispipeline.h>
+#include <table.h>
 
 using StringPair = std::pair<std::string, std::string>;
 using Records = std::unordered_map<std::string, std::string>;
 using HashOfRecords = std::unordered_map<std::string, Records>;
+using LagNames = std::unordered_set<std::string>;
+
+struct ValuesStoreStats
+{
+    size_t dumps = 0;           // number of dumps received
+    size_t parsed = 0;          // number of dumps which were changed and parsed
+    size_t fields_written = 0;  // number of fields written to the db
+    size_t keys_removed = 0;    // number of keys removed from the db
+};
 
 class ValuesStore
 {
 public:
-    ValuesStore(const swss::DBConnector * db) : m_db(db) {};
+    ValuesStore(const swss::DBConnector * db) : m_pipeline(db) {};
     void update(const std::vector<StringPair> & dumps);
+    const ValuesStoreStats & get_last_stats() const { return m_last_stats; }
 
 private:
     enum class json_type
@@ -33,17 +48,23 @@ private:
     std::string unpack_boolean(json_t * root, const std::string & key, const std::string & path);
     std::string unpack_integer(json_t * root, const std::string & key, const std::string & path);
     std::string get_value(json_t * root, const std::string & path, ValuesStore::json_type type);
-    HashOfRecords from_json(const std::vector<StringPair> & dumps);
-    std::vector<std::string> get_old_keys(const HashOfRecords & storage);
+    HashOfRecords from_json(const std::vector<StringPair> & dumps, LagNames & unchanged_lags);
+    std::vector<std::string> get_old_keys(const HashOfRecords & storage, const LagNames & unchanged_lags);
     void remove_keys_storage(const std::vector<std::string> & keys);
     void remove_keys_db(const std::vector<std::string> & keys);
     StringPair split_key(const std::string & key);
-    std::vector<std::string> update_storage(const HashOfRecords & storage);
-    void update_db(const HashOfRecords & storage, const std::vector<std::string> & keys_to_refresh);
+    std::string get_lag_name(const std::string & key);
+    HashOfRecords update_storage(const HashOfRecords & storage);
+    void update_db(const HashOfRecords & changes);
+    void update_dumps(const std::vector<StringPair> & dumps);
+    swss::Table & get_table(const std::string & table_name);
     void extract_values(const std::string & lag_name, json_t * root, HashOfRecords & storage);
 
     HashOfRecords m_storage;  // our main storage
-    const swss::DBConnector * m_db;
+    std::unordered_map<std::string, std::string> m_dumps;  // the last dump which was stored, per LAG
+    swss::RedisPipeline m_pipeline;
+    std::unordered_map<std::string, std::unique_ptr<swss::Table>> m_tables;
+    ValuesStoreStats m_last_stats;
 
     const std::vector<std::pair<std::string, ValuesStore::json_type>> m_lag_paths = {
         { "setup.kernel_team_mode_name", ValuesStore::json_type::string  },
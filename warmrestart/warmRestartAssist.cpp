@@ -1,5 +1,6 @@
 #include <string>
 #include <algorithm>
+#include <inttypes.h>
 #include "logger.h"
 #include "schema.h"
 #include "warm_restart.h"
@@ -8,6 +9,9 @@
 using namespace std;
 using namespace swss;
 
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME        0x100000001b3ULL
+
 // Translation map from enum to string for cache entry state.
 const AppRestartAssist::cache_state_map AppRestartAssist::cacheStateMap =
 {
@@ -22,7 +26,14 @@ AppRestartAssist::AppRestartAssist(RedisPipeline *pipelineAppDB, const std::stri
     m_pipeLine(pipelineAppDB),
     m_appName(appName),
     m_dockerName(dockerName),
-    m_warmStartTimer(timespec{0, 0})
+    m_warmStartTimer(timespec{0, 0}),
+    m_incrementalReconcile(false),
+    m_stateDb("STATE_DB", 0),
+    m_stateWarmRestartTable(&m_stateDb, STATE_WARM_RESTART_TABLE_NAME),
+    m_restoredEntries(0),
+    m_streamedEntries(0),
+    m_restoreTimeMs(0),
+    m_restoreStart(chrono::steady_clock::now())
 {
     WarmStart::initialize(m_appName, m_dockerName);
     WarmStart::checkWarmStart(m_appName, m_dockerName);
@@ -97,24 +108,35 @@ string AppRestartAssist::joinVectorString(const vector<FieldValueTuple> &fv)
     return s;
 }
 
-// Set the cache entry state
-void AppRestartAssist::setCacheEntryState(std::vector<FieldValueTuple> &fvVector,
-    cache_state_t state)
+// 64 bit FNV-1a digest of a field/value pair
+uint64_t AppRestartAssist::getFieldDigest(const FieldValueTuple &fv)
 {
-    fvVector.back().second = cacheStateMap.at(state);
+    uint64_t digest = FNV_OFFSET_BASIS;
+
+    for (unsigned char c : fvField(fv))
+    {
+        digest = (digest ^ c) * FNV_PRIME;
+    }
+    // separate the field from the value, so that "ab":"c" and "a":"bc" differ
+    digest *= FNV_PRIME;
+    for (unsigned char c : fvValue(fv))
+    {
+        digest = (digest ^ c) * FNV_PRIME;
+    }
+
+    return digest;
 }
 
-// Get the cache entry state
-AppRestartAssist::cache_state_t AppRestartAssist::getCacheEntryState(const std::vector<FieldValueTuple> &fvVector)
+void AppRestartAssist::setFieldDigests(CacheEntry &entry, const std::vector<FieldValueTuple> &fvVector)
 {
-    for (auto &iter : cacheStateMap)
+    entry.fieldDigests.clear();
+    entry.fieldDigests.reserve(fvVector.size());
+    for (const auto &fv : fvVector)
     {
-        if (fvVector.back().second == iter.second)
-        {
-            return iter.first;
-        }
+        entry.fieldDigests.push_back(getFieldDigest(fv));
     }
-    throw std::logic_error("cache entry state is invalid");
+    sort(entry.fieldDigests.begin(), entry.fieldDigests.end());
+    entry.fieldDigests.shrink_to_fit();
 }
 
 void AppRestartAssist::appDataReplayed()
@@ -127,15 +149,18 @@ void AppRestartAssist::warmStartDisabled()
     WarmStart::setWarmStartState(m_appName, WarmStart::WSDISABLED);
 }
 
-// Read table(s) from APPDB and append stale flag then insert to cachemap
+// Read table(s) from APPDB, keep the digests of the entries with stale flag in cachemap
 void AppRestartAssist::readTablesToMap()
 {
     vector<string> keys;
 
+    m_restoreStart = chrono::steady_clock::now();
+
     for (auto it = m_appTables.begin(); it != m_appTables.end(); it++)
     {
         (it->second)->getKeys(keys);
-        FieldValueTuple state(CACHE_STATE_FIELD, "");
+        auto &cacheMap = appTableCacheMap[it->first];
+        cacheMap.reserve(cacheMap.size() + keys.size());
 
         for (const auto &key: keys)
         {
@@ -147,20 +172,23 @@ void AppRestartAssist::readTablesToMap()
                 continue;
             }
 
-            fv.push_back(state);
-            setCacheEntryState(fv, STALE);
-
-            string s = joinVectorString(fv);
-
             SWSS_LOG_INFO("write to cachemap: %s, key: %s, "
-                   "%s", (it->first).c_str(), key.c_str(), s.c_str());
+                   "%s", (it->first).c_str(), key.c_str(), joinVectorString(fv).c_str());
 
             // insert to the cache map
-            appTableCacheMap[it->first][key] = fv;
+            auto &entry = cacheMap[key];
+            setFieldDigests(entry, fv);
+            entry.state = STALE;
+            entry.pending = false;
+            m_restoredEntries++;
         }
         WarmStart::setWarmStartState(m_appName, WarmStart::RESTORED);
         SWSS_LOG_NOTICE("Restored appDB table to %s internal cache map", (it->first).c_str());
     }
+
+    m_restoreTimeMs = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - m_restoreStart).count();
+    SWSS_LOG_NOTICE("Restored %" PRIu64 " entries in %" PRIu64 " ms, cache size %zu bytes",
+                    m_restoredEntries, m_restoreTimeMs, getCacheSize());
     return;
 }
 
@@ -175,74 +203,84 @@ void AppRestartAssist::readTablesToMap()
  *  } else {
  *    insert with "NEW" flag.
  *   }
+ * With incremental reconciliation, the "NEW" entries are written to appDB
+ * right away and only their digests are kept.
  */
 void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldValueTuple> fvVector, bool delete_key)
 {
     SWSS_LOG_INFO("Received message %s, key: %s, "
             "%s, delete = %d", tableName.c_str(), key.c_str(), joinVectorString(fvVector).c_str(), delete_key);
 
-    auto found = appTableCacheMap[tableName].find(key);
+    auto &cacheMap = appTableCacheMap[tableName];
+    auto found = cacheMap.find(key);
 
     if (delete_key)
     {
         SWSS_LOG_NOTICE("%s, delete key: %s, ", tableName.c_str(), key.c_str());
         /* mark it as DELETE if exist, otherwise, no-op */
-        if (found != appTableCacheMap[tableName].end())
+        if (found != cacheMap.end())
         {
-            setCacheEntryState(found->second, DELETE);
+            found->second.state = DELETE;
+            found->second.pending = false;
+            found->second.pendingFvVector.clear();
         }
+        return;
     }
-    else if (found != appTableCacheMap[tableName].end())
+
+    if (found != cacheMap.end() && contains(found->second, fvVector))
     {
-        // check only the original vector range (exclude cache-state field/value)
-        if(! contains(found->second, fvVector))
+        /*
+         * In case an entry has been updated for more than once with the same value but different from the stored one,
+         * keep the state as NEW.
+         * Eg.
+         * Assume the entry's value that is restored from last warm reboot is V0.
+         * 1. The first update with value V1 is received and handled by the NEW branch below,
+         *    - state is set to NEW
+         *    - value is updated to V1
+         * 2. The second update with the same value V1 is received and handled by this branch
+         *    - Originally, state was set to SAME, which is wrong because V1 is different from the stored value V0
+         *    - The correct logic should be: set the state to same only if the state is not NEW
+         * This is a very rare case because in most of times the entry won't be updated for multiple times
+         */
+        if (found->second.state == NEW)
         {
-            SWSS_LOG_NOTICE("%s, found key: %s, new value ", tableName.c_str(), key.c_str());
-
-            FieldValueTuple state(CACHE_STATE_FIELD, "");
-            fvVector.push_back(state);
-
-            // mark as NEW flag
-            setCacheEntryState(fvVector, NEW);
-            appTableCacheMap[tableName][key] = fvVector;
+            SWSS_LOG_NOTICE("%s, found key: %s, it has been updated for the second time, keep state as NEW",
+                            tableName.c_str(), key.c_str());
         }
         else
         {
-            auto state = getCacheEntryState(found->second);
-            /*
-             * In case an entry has been updated for more than once with the same value but different from the stored one,
-             * keep the state as NEW.
-             * Eg.
-             * Assume the entry's value that is restored from last warm reboot is V0.
-             * 1. The first update with value V1 is received and handled by the above `if (found != appTableCacheMap[tableName].end())` branch,
-             *    - state is set to NEW
-             *    - value is updated to V1
-             * 2. The second update with the same value V1 is received and handled by this branch
-             *    - Originally, state was set to SAME, which is wrong because V1 is different from the stored value V0
-             *    - The correct logic should be: set the state to same only if the state is not NEW
-             * This is a very rare case because in most of times the entry won't be updated for multiple times
-             */
-            if (state == NEW)
-            {
-                SWSS_LOG_NOTICE("%s, found key: %s, it has been updated for the second time, keep state as NEW",
-                                tableName.c_str(), key.c_str());
-            }
-            else
-            {
-                SWSS_LOG_INFO("%s, found key: %s, same value", tableName.c_str(), key.c_str());
-                // mark as SAME flag
-                setCacheEntryState(found->second, SAME);
-            }
+            SWSS_LOG_INFO("%s, found key: %s, same value", tableName.c_str(), key.c_str());
+            // mark as SAME flag
+            found->second.state = SAME;
         }
+        return;
+    }
+
+    if (found != cacheMap.end())
+    {
+        SWSS_LOG_NOTICE("%s, found key: %s, new value ", tableName.c_str(), key.c_str());
     }
     else
     {
-        // not found, mark the entry as NEW and insert to map
         SWSS_LOG_NOTICE("%s, not found key: %s, new", tableName.c_str(), key.c_str());
-        FieldValueTuple state(CACHE_STATE_FIELD, "");
-        fvVector.push_back(state);
-        setCacheEntryState(fvVector, NEW);
-        appTableCacheMap[tableName][key] = fvVector;
+    }
+
+    // mark the entry as NEW and insert to map
+    auto &entry = cacheMap[key];
+    setFieldDigests(entry, fvVector);
+    entry.state = NEW;
+
+    if (m_incrementalReconcile)
+    {
+        m_psTables[tableName]->set(key, fvVector);
+        entry.pending = false;
+        entry.pendingFvVector.clear();
+        m_streamedEntries++;
+    }
+    else
+    {
+        entry.pending = true;
+        entry.pendingFvVector = std::move(fvVector);
     }
     return;
 }
@@ -252,44 +290,52 @@ void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldVal
  *  iterate through the cache map
  *  if the entry has "SAME" flag, do nothing
  *  if has "STALE/DELETE" flag, delete it from appDB.
- *  else if "NEW" flag,  add it to appDB
+ *  else if "NEW" flag,  add it to appDB unless it was written already
  *  else, throw (should never happen)
  */
 void AppRestartAssist::reconcile()
 {
     std::string tableName;
+    std::map<cache_state_t, uint64_t> stateCounts;
 
     SWSS_LOG_ENTER();
+
+    auto start = chrono::steady_clock::now();
+    size_t cacheSize = getCacheSize();
+
     for (auto tableIter = appTableCacheMap.begin(); tableIter != appTableCacheMap.end(); ++tableIter)
     {
         tableName = tableIter->first;
         for (auto it = (tableIter->second).begin(); it != (tableIter->second).end(); ++it)
         {
-            string s = joinVectorString(it->second);
-            auto state = getCacheEntryState(it->second);
+            auto state = it->second.state;
+            stateCounts[state]++;
 
             if (state == SAME)
             {
-                SWSS_LOG_INFO("%s SAME, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+                SWSS_LOG_INFO("%s SAME, key: %s", tableName.c_str(), it->first.c_str());
                 continue;
             }
             else if (state == STALE || state == DELETE)
             {
-                SWSS_LOG_NOTICE("%s STALE/DELETE, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+                SWSS_LOG_NOTICE("%s STALE/DELETE, key: %s", tableName.c_str(), it->first.c_str());
 
                 //delete from appDB
                 m_psTables[tableName]->del(it->first);
             }
             else if (state == NEW)
             {
-                SWSS_LOG_NOTICE("%s NEW, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+                if (!it->second.pending)
+                {
+                    SWSS_LOG_INFO("%s NEW, key: %s, written already", tableName.c_str(), it->first.c_str());
+                    continue;
+                }
+
+                SWSS_LOG_NOTICE("%s NEW, key: %s, %s", tableName.c_str(), it->first.c_str(),
+                                joinVectorString(it->second.pendingFvVector).c_str());
 
-                //add to appDB, exclude the state
-                it->second.pop_back();
-                m_psTables[tableName]->set(it->first, it->second);
+                //add to appDB
+                m_psTables[tableName]->set(it->first, it->second.pendingFvVector);
             }
             else
             {
@@ -300,11 +346,61 @@ void AppRestartAssist::reconcile()
         appTableCacheMap[tableName].clear();
     }
     appTableCacheMap.clear();
+
+    uint64_t reconcileTimeMs = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+    SWSS_LOG_NOTICE("Reconciled %zu bytes of cache in %" PRIu64 " ms, same %" PRIu64 ", new %" PRIu64
+                    ", stale %" PRIu64 ", deleted %" PRIu64, cacheSize, reconcileTimeMs,
+                    stateCounts[SAME], stateCounts[NEW], stateCounts[STALE], stateCounts[DELETE]);
+    publishReconcileStats(stateCounts, reconcileTimeMs, cacheSize);
+
     WarmStart::setWarmStartState(m_appName, WarmStart::RECONCILED);
     m_warmStartInProgress = false;
     return;
 }
 
+// Approximate memory used by the cache map
+size_t AppRestartAssist::getCacheSize() const
+{
+    size_t size = 0;
+
+    for (const auto &table : appTableCacheMap)
+    {
+        for (const auto &entry : table.second)
+        {
+            size += sizeof(entry) + entry.first.capacity() +
+                    entry.second.fieldDigests.capacity() * sizeof(uint64_t);
+            for (const auto &fv : entry.second.pendingFvVector)
+            {
+                size += sizeof(fv) + fvField(fv).capacity() + fvValue(fv).capacity();
+            }
+        }
+    }
+
+    return size;
+}
+
+// Publish the statistics of the last reconciliation to STATE_DB WARM_RESTART_TABLE
+void AppRestartAssist::publishReconcileStats(std::map<cache_state_t, uint64_t> &stateCounts,
+                                             uint64_t reconcileTimeMs, size_t cacheSize)
+{
+    uint64_t totalTimeMs = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - m_restoreStart).count();
+
+    vector<FieldValueTuple> fvs = {
+        {"restored_entries", to_string(m_restoredEntries)},
+        {"same_entries", to_string(stateCounts[SAME])},
+        {"new_entries", to_string(stateCounts[NEW])},
+        {"stale_entries", to_string(stateCounts[STALE])},
+        {"deleted_entries", to_string(stateCounts[DELETE])},
+        {"streamed_entries", to_string(m_streamedEntries)},
+        {"cache_size_bytes", to_string(cacheSize)},
+        {"restore_time_ms", to_string(m_restoreTimeMs)},
+        {"reconcile_time_ms", to_string(reconcileTimeMs)},
+        {"total_time_ms", to_string(totalTimeMs)}
+    };
+
+    m_stateWarmRestartTable.set(m_appName, fvs);
+}
+
 // set the reconcile interval
 void AppRestartAssist::setReconcileInterval(uint32_t time)
 {
@@ -336,13 +432,12 @@ bool AppRestartAssist::checkReconcileTimer(Selectable *s)
     return false;
 }
 
-// check if left vector contains all elements of right vector
-bool AppRestartAssist::contains(const std::vector<FieldValueTuple>& left,
-              const std::vector<FieldValueTuple>& right)
+// check if the cached entry contains all field/value pairs of the vector
+bool AppRestartAssist::contains(const CacheEntry &entry, const std::vector<FieldValueTuple> &fvVector)
 {
-    for (auto const& rv : right)
+    for (auto const &fv : fvVector)
     {
-        if (std::find(left.begin(), left.end(), rv) == left.end())
+        if (!binary_search(entry.fieldDigests.begin(), entry.fieldDigests.end(), getFieldDigest(fv)))
         {
             return false;
         }
@@ -3,6 +3,7 @@
 
 #include <unordered_map>
 #include <string>
+#include <chrono>
 #include "dbconnector.h"
 #include "table.h"
 #include "producerstatetable.h"
@@ -49,6 +50,16 @@ namespace swss {
  *              appClass.getRestartAssist()->reconcile();
  *          }
  *      }
+ *
+ * The cache keeps a 64 bit digest of every field/value pair of an entry rather
+ * than a copy of the fields, the fields are only kept for entries waiting to be
+ * written at reconciliation. With incremental reconciliation enabled, new and
+ * updated entries are written to the application table as soon as they are
+ * inserted, so that only the stale and deleted entries are left to reconcile
+ * when the timer expires.
+ *
+ * Reconciliation statistics are published in the application entry of the
+ * STATE_DB WARM_RESTART_TABLE when reconciliation is done.
  */
 typedef std::map <std::string, Table *>              Tables;
 typedef std::map <std::string, ProducerStateTable *> ProducerStateTables;
@@ -84,6 +95,10 @@ public:
     void warmStartDisabled(void);
     void insertToMap(std::string tableName, std::string key, std::vector<FieldValueTuple> fvVector, bool delete_key);
     void reconcile(void);
+    void setIncrementalReconcile(bool enable)
+    {
+        m_incrementalReconcile = enable;
+    }
     bool isWarmStartInProgress(void)
     {
         return m_warmStartInProgress;
@@ -94,7 +109,6 @@ private:
     typedef std::map<cache_state_t, std::string> cache_state_map;
     // Enum to string translation map
     static const cache_state_map cacheStateMap;
-    const std::string CACHE_STATE_FIELD = "cache-state";
 
     /*
      * Default timer to be 5 seconds
@@ -102,7 +116,15 @@ private:
      * Precedence ascent order: Default -> loading class with value -> configuration
      */
     static const uint32_t DEFAULT_INTERNAL_TIMER_VALUE = 5;
-    typedef std::map<std::string, std::unordered_map<std::string, std::vector<swss::FieldValueTuple>>> AppTableMap;
+
+    struct CacheEntry
+    {
+        std::vector<uint64_t> fieldDigests;           // sorted digests of the field/value pairs
+        std::vector<FieldValueTuple> pendingFvVector; // fields of a NEW entry not written yet
+        cache_state_t state;
+        bool pending;                                 // NEW entry waiting to be written
+    };
+    typedef std::map<std::string, std::unordered_map<std::string, CacheEntry>> AppTableMap;
 
     // cache map to store temporary application table
     AppTableMap appTableCacheMap;
@@ -116,13 +138,25 @@ private:
     bool m_warmStartInProgress;       // indicate if warm start is in progress
     time_t m_reconcileTimer;          // reconcile timer value
     SelectableTimer m_warmStartTimer; // reconcile timer
+    bool m_incrementalReconcile;      // write NEW entries as soon as they are inserted
+
+    DBConnector m_stateDb;
+    Table m_stateWarmRestartTable;
+
+    // Reconciliation statistics
+    uint64_t m_restoredEntries;
+    uint64_t m_streamedEntries;
+    uint64_t m_restoreTimeMs;
+    std::chrono::steady_clock::time_point m_restoreStart;
 
-    // Set or get cache entry state
     std::string joinVectorString(const std::vector<FieldValueTuple> &fv);
-    void setCacheEntryState(std::vector<FieldValueTuple> &fvVector, cache_state_t state);
-    cache_state_t getCacheEntryState(const std::vector<FieldValueTuple> &fvVector);
-    bool contains(const std::vector<FieldValueTuple>& left,
-                  const std::vector<FieldValueTuple>& right);
+    static uint64_t getFieldDigest(const FieldValueTuple &fv);
+    static void setFieldDigests(CacheEntry &entry, const std::vector<FieldValueTuple> &fvVector);
+    // check if the cached entry contains all field/value pairs of the vector
+    static bool contains(const CacheEntry &entry, const std::vector<FieldValueTuple> &fvVector);
+    size_t getCacheSize() const;
+    void publishReconcileStats(std::map<cache_state_t, uint64_t> &stateCounts,
+                               uint64_t reconcileTimeMs, size_t cacheSize);
 };
 
 }